@@ -0,0 +1,216 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bcd.h
+ ** @brief Aritmética BCD sobre clock_time_t tratando los seis dígitos como una sola palabra de 64 bits.
+ ** @details Cada byte de la palabra guarda un dígito, en el mismo orden que clock_time_t, por lo que los acarreos de
+ ** segundos y minutos se resuelven en paralelo sobre los cuatro bytes de la parte baja. En los Cortex-M4 se usan las
+ ** instrucciones DSP que operan sobre bytes, en el resto de los procesadores se usan operaciones enteras comunes. Las
+ ** horas se tratan aparte porque su límite de 24 abarca los dos dígitos.
+ **/
+
+#ifndef BCD_H_
+#define BCD_H_
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "clock.h"
+
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#endif
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#error "bcd.h supone que la palabra se carga en orden little endian"
+#endif
+
+#define BCD_SECONDS 0x00000000FFFFULL // Bytes de la palabra que ocupan los segundos
+#define BCD_MINUTES 0x0000FFFF0000ULL // Bytes de la palabra que ocupan los minutos
+#define BCD_HOURS   0xFFFF00000000ULL // Bytes de la palabra que ocupan las horas
+
+#define BCD_ONE_SECOND 0x000000000001ULL // Un segundo en formato de palabra BCD
+#define BCD_ONE_MINUTE 0x000000010000ULL // Un minuto en formato de palabra BCD
+#define BCD_ONE_HOUR   0x000100000000ULL // Una hora en formato de palabra BCD
+
+#define BCD_LOW_RADIX 0x060A060AUL // Base de cada digito de segundos y minutos, de unidades de segundo en adelante
+#define BCD_LOW_MAX   0x05090509UL // Mayor valor de cada digito de segundos y minutos
+#define BCD_LANE_BIT  0x80808080UL // Bit mas significativo de cada byte de la parte baja
+#define BCD_LANE_ONE  0x01010101UL // Bit menos significativo de cada byte de la parte baja
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Hora en BCD cargada en una palabra, un digito por byte empezando por las unidades de segundo.
+ */
+typedef uint64_t bcd_word_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Carga una hora en una palabra BCD.
+ *
+ * @param time Puntero a la hora que se desea cargar.
+ * @return Palabra con los seis dígitos de la hora.
+ */
+static inline bcd_word_t BcdLoad(const clock_time_t * time) {
+    bcd_word_t word = 0;
+    memcpy(&word, time->bcd, sizeof(time->bcd));
+    return word;
+}
+
+/**
+ * @brief Guarda una palabra BCD en una hora.
+ *
+ * @param word Palabra con los seis dígitos de la hora.
+ * @param time Puntero donde se almacenará la hora.
+ */
+static inline void BcdStore(bcd_word_t word, clock_time_t * time) {
+    memcpy(time->bcd, &word, sizeof(time->bcd));
+}
+
+/**
+ * @brief Obtiene el valor binario de las horas de una palabra BCD.
+ */
+static inline uint32_t BcdHours(bcd_word_t word) {
+    return ((word >> 40) & 0xFF) * 10 + ((word >> 32) & 0xFF);
+}
+
+/**
+ * @brief Arma la parte de las horas de una palabra BCD a partir de su valor binario.
+ */
+static inline bcd_word_t BcdFromHours(uint32_t hours) {
+    return ((bcd_word_t)(hours / 10) << 40) | ((bcd_word_t)(hours % 10) << 32);
+}
+
+/**
+ * @brief Verifica que todos los dígitos de una palabra BCD formen una hora válida.
+ *
+ * @param word Palabra que se desea verificar.
+ * @return true si la hora es válida, false si algún dígito está fuera de rango.
+ */
+static inline bool BcdIsValid(bcd_word_t word) {
+    uint32_t low = (uint32_t)word;
+
+    // Al sumar 0x80 menos la base a cada byte, se enciende el bit 7 de los digitos que superan su base
+    if ((((low + (BCD_LANE_BIT - BCD_LOW_RADIX)) | low) & BCD_LANE_BIT) || (word >> 48)) {
+        return false;
+    }
+    return ((word >> 32) & 0xFF) <= 9 && ((word >> 40) & 0xFF) <= 2 && BcdHours(word) < 24;
+}
+
+/**
+ * @brief Compara dos palabras BCD válidas.
+ *
+ * @return Negativo si a es anterior a b, cero si son iguales y positivo si a es posterior a b.
+ */
+static inline int BcdCompare(bcd_word_t a, bcd_word_t b) {
+    // Como las decenas de hora ocupan el byte mas significativo, la palabra se ordena igual que la hora
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief Lleva a su rango los dígitos de una palabra BCD que quedaron con valores entre la base y 19, por ejemplo
+ * después de sumar dos horas dígito a dígito. El resultado da la vuelta a las 24 horas.
+ *
+ * @param word Palabra con los dígitos a normalizar.
+ * @return Palabra con todos sus dígitos válidos.
+ */
+static inline bcd_word_t BcdNormalize(bcd_word_t word) {
+    uint32_t low = (uint32_t)word;
+    uint32_t overflow;
+    uint32_t carry = 0;
+
+    // Se resuelven en paralelo los acarreos de los cuatro digitos de segundos y minutos, repitiendo mientras un
+    // acarreo haga desbordar al digito siguiente
+    do {
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+        uint32_t reduced = __usub8(low, BCD_LOW_RADIX); // Activa el flag GE de los bytes que alcanzan su base
+        low = __sel(reduced, low);
+        overflow = __sel(BCD_LANE_ONE, 0);
+#else
+        overflow = ((low + (BCD_LANE_BIT - BCD_LOW_RADIX)) >> 7) & BCD_LANE_ONE;
+        low -= (overflow * 0xFF) & BCD_LOW_RADIX;
+#endif
+        carry += overflow >> 24; // Acarreo de las decenas de minuto hacia las horas
+        low += overflow << 8;
+    } while (overflow);
+
+    return low | BcdFromHours((BcdHours(word) + carry) % 24);
+}
+
+/**
+ * @brief Suma dos palabras BCD válidas, dando la vuelta a las 24 horas.
+ */
+static inline bcd_word_t BcdAdd(bcd_word_t a, bcd_word_t b) {
+    return BcdNormalize(a + b);
+}
+
+/**
+ * @brief Resta dos palabras BCD válidas, dando la vuelta a las 24 horas.
+ */
+static inline bcd_word_t BcdSubtract(bcd_word_t a, bcd_word_t b) {
+    // Se suma el complemento de b a 24 horas, que dígito a dígito es 23:59:59 menos b más un segundo
+    bcd_word_t complement = (BCD_LOW_MAX - (uint32_t)b) | BcdFromHours(23 - BcdHours(b));
+    return BcdAdd(a, BcdAdd(complement, BCD_ONE_SECOND));
+}
+
+/**
+ * @brief Suma una cantidad a un solo campo de una palabra BCD, dando la vuelta dentro del campo sin modificar el resto.
+ *
+ * @param word Palabra que se desea modificar.
+ * @param delta Cantidad a sumar, por ejemplo BCD_ONE_MINUTE.
+ * @param field Campo que se desea modificar: BCD_SECONDS, BCD_MINUTES o BCD_HOURS.
+ * @return Palabra con el campo modificado.
+ */
+static inline bcd_word_t BcdAddField(bcd_word_t word, bcd_word_t delta, bcd_word_t field) {
+    return (word & ~field) | (BcdAdd(word & field, delta & field) & field);
+}
+
+/**
+ * @brief Resta una cantidad a un solo campo de una palabra BCD, dando la vuelta dentro del campo sin modificar el
+ * resto.
+ *
+ * @param word Palabra que se desea modificar.
+ * @param delta Cantidad a restar, por ejemplo BCD_ONE_MINUTE.
+ * @param field Campo que se desea modificar: BCD_SECONDS, BCD_MINUTES o BCD_HOURS.
+ * @return Palabra con el campo modificado.
+ */
+static inline bcd_word_t BcdSubtractField(bcd_word_t word, bcd_word_t delta, bcd_word_t field) {
+    return (word & ~field) | (BcdSubtract(word & field, delta & field) & field);
+}
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BCD_H_ */
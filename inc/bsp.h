@@ -38,8 +38,25 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+#define BOARD_LED_RED   (1 << 0) // Bit del rojo en el estado de board->indicators
+#define BOARD_LED_GREEN (1 << 1) // Bit del verde en el estado de board->indicators
+#define BOARD_LED_BLUE  (1 << 2) // Bit del azul en el estado de board->indicators
+#define BOARD_BUZZER    (1 << 3) // Bit del zumbador en el estado de board->indicators
+
 /* === Public data type declarations =============================================================================== */
 
+/**
+ * @brief Función que atiende el evento del temporizador de la pantalla, con la misma forma que hal_tick_event_t.
+ * @param object Puntero a los datos de usuario indicados al iniciar el temporizador.
+ */
+typedef void (*board_timer_event_t)(void * object);
+
+/**
+ * @brief Función que atiende un flanco en alguna de las teclas, con la misma forma que board_timer_event_t.
+ * @param object Puntero a los datos de usuario indicados al iniciar los eventos de las teclas.
+ */
+typedef void (*board_key_event_t)(void * object);
+
 /**
  * @brief Estructura que representa la placa de desarrollo.
  * @details Esta estructura contiene los componentes digitales y la pantalla asociados a la placa.
@@ -52,9 +69,11 @@ typedef struct Board_s {
     digital_input_t increment;
     digital_input_t accept;
     digital_input_t cancel;
+    digital_input_group_t keys; //!< Teclas del poncho, se muestrean juntas con una lectura por puerto
     digital_output_t led_red;
     digital_output_t led_green;
     digital_output_t led_blue;
+    digital_output_group_t indicators; //!< LED RGB y zumbador, cambian juntos con una escritura por puerto
 
     screen_t screen;
 } const * Board_t;
@@ -69,10 +88,36 @@ typedef struct Board_s {
  */
 void SysTickInit(uint16_t ticks);
 
+/**
+ * @brief Inicia el temporizador periódico que multiplexa la pantalla.
+ * @details Usa el temporizador de interrupción repetitiva, ya que el SysTick lo ocupa el sistema operativo. La función
+ * se ejecuta en la interrupción, por lo que no debe llamar a funciones del sistema operativo.
+ * @param handler Función que se llama en cada evento del temporizador.
+ * @param object Puntero a los datos de usuario que recibe la función.
+ * @param period Período entre eventos, en microsegundos.
+ */
+void DisplayTimerStart(board_timer_event_t handler, void * object, uint32_t period);
+
+/**
+ * @brief Configura las interrupciones por cambio de terminal de las teclas, que quedan deshabilitadas.
+ * @details Cada tecla ocupa un canal de interrupción de terminal y detecta ambos flancos. La función se ejecuta en la
+ * interrupción, con una prioridad que permite usar las funciones FromISR del sistema operativo. El primer flanco
+ * deshabilita las interrupciones de todas las teclas, para que los rebotes no las repitan.
+ * @param handler Función que se llama con el primer flanco de cualquier tecla.
+ * @param object Puntero a los datos de usuario que recibe la función.
+ */
+void KeyEventsStart(board_key_event_t handler, void * object);
+
+/**
+ * @brief Vuelve a habilitar las interrupciones de las teclas, descartando los flancos ocurridos mientras no lo estaban.
+ * @return true si la placa avisa los flancos, false si no puede hacerlo y las teclas se deben seguir muestreando.
+ */
+bool KeyEventsEnable(void);
+
 /**
  * @brief Crea e instancia la estructura que representa la placa de desarrollo.
  * @return Un identificador para la placa de desarrollo.
- * @note Esta función instancia la estructura y retorna su descriptor.
+ * @note La placa y sus objetos se reservan en forma estática, no se usa memoria dinámica.
  */
 Board_t BoardCreate(void);
 
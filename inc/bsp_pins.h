@@ -0,0 +1,66 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef BSP_PINS_H_
+#define BSP_PINS_H_
+
+/** @file bsp_pins.h
+ ** @brief Funciones que implementa el bsp de cada placa para el código común de bsp.c.
+ ** @details bsp.c crea la pantalla, las entradas y las salidas sobre digital_port.h, igual en todas las placas. Cada
+ ** placa solo conecta los terminales del poncho y provee el temporizador de la pantalla y los eventos de las teclas
+ ** declarados en bsp.h.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "screen.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Conecta a sus puertos gpio todos los terminales del poncho, antes de configurar su dirección.
+ */
+void BoardPinsInit(void);
+
+/**
+ * @brief Elige el controlador con que se crea la pantalla de la placa.
+ * @param driver Controlador común, que escribe los dígitos y los segmentos del poncho con digital_port.h.
+ * @return El controlador recibido o uno propio de la placa.
+ */
+screen_driver_t BoardScreenDriver(screen_driver_t driver);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BSP_PINS_H_ */
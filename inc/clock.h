@@ -43,6 +43,31 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+#ifndef CLOCK_MAX_ALARMS
+#define CLOCK_MAX_ALARMS 8 // Capacidad de la tabla de alarmas, incluyendo las alarmas pospuestas
+#endif
+
+#ifndef CLOCK_MAX_INSTANCES
+#define CLOCK_MAX_INSTANCES 1 // Cantidad de relojes que puede entregar ClockCreate sin memoria del usuario
+#endif
+
+// Bytes que ocupa un reloj, el modulo verifica al compilar que alcancen para su estructura interna
+#define CLOCK_STORAGE_SIZE (96 + 12 * CLOCK_MAX_ALARMS)
+
+#define CLOCK_MAIN_ALARM    0    // Identificador de la alarma que manejan ClockSetAlarmTime y ClockEnableAlarm
+#define CLOCK_INVALID_ALARM 0xFF // Identificador que indica que la alarma no se pudo crear
+
+#define CLOCK_MAX_CALIBRATION_PPM 100000 // Maxima corrección de frecuencia aceptada por ClockSetCalibration
+
+#define CLOCK_MIN_YEAR         2000 // Primer año del calendario, la fecha inicial es el 1 de enero
+#define CLOCK_MAX_YEAR         2099 // Ultimo año del calendario
+#define CLOCK_MIN_YEAR_WEEKDAY CLOCK_SATURDAY // Dia de la semana del 1 de enero de CLOCK_MIN_YEAR
+
+#define CLOCK_DAY_MASK(weekday) (1U << (weekday)) // Bit que representa un dia de la semana en la mascara de una alarma
+#define CLOCK_EVERY_DAY         0x7F              // Mascara de una alarma que suena todos los dias
+#define CLOCK_WORKDAYS          0x3E              // Mascara de una alarma que suena de lunes a viernes
+#define CLOCK_WEEKEND           0x41              // Mascara de una alarma que suena sabados y domingos
+
 /* === Public data type declarations =============================================================================== */
 
 /** @brief Modo del sistema para la configuración del reloj y la alarma.
@@ -83,14 +108,101 @@ typedef union {
     uint8_t bcd[6];
 } clock_time_t;
 
+/**
+ * @brief Referencia a un reloj.
+ *
+ * Las funciones de consulta se pueden llamar desde cualquier tarea sin exclusión mutua: leen el reloj sin bloquearlo y
+ * repiten la lectura si otra tarea lo modificó mientras tanto, por lo que nunca devuelven una hora a medio actualizar.
+ * Las funciones que modifican el reloj se serializan entre sí, pero el tiempo lo debe avanzar una sola tarea con
+ * ClockNewTick o ClockAdvanceTicks, y ninguna de ellas se debe llamar desde una interrupción. Con un solo núcleo se
+ * debe compilar con CLOCK_CRITICAL_HOOKS, para que una lectura nunca espere a una escritura que quedó interrumpida.
+ */
 typedef struct clock_s * clock_t;
 
+/**
+ * @brief Memoria para crear un reloj con ClockCreateStatic.
+ *
+ * Su contenido es privado del modulo, solo se declara para que la aplicación pueda reservarla en forma estática.
+ */
+typedef union {
+    uint8_t reserved[CLOCK_STORAGE_SIZE];
+    uint64_t align; // Garantiza la alineación que requiere la estructura interna del reloj
+} clock_storage_t;
+
+/**
+ * @brief Descripción de una alarma de la tabla, usada para recorrerla desde la interfaz de usuario.
+ */
+typedef struct {
+    uint8_t id;        // Identificador de la alarma
+    clock_time_t time; // Hora de vencimiento
+    bool enabled;      // Indica si la alarma está habilitada
+    bool snooze;       // Indica si es una alarma pospuesta, que suena una sola vez
+    uint8_t weekdays;  // Dias de la semana en que suena la alarma, ver CLOCK_DAY_MASK
+} clock_alarm_info_t;
+
+/**
+ * @brief Dias de la semana.
+ */
+typedef enum {
+    CLOCK_SUNDAY = 0,
+    CLOCK_MONDAY,
+    CLOCK_TUESDAY,
+    CLOCK_WEDNESDAY,
+    CLOCK_THURSDAY,
+    CLOCK_FRIDAY,
+    CLOCK_SATURDAY,
+} clock_weekday_t;
+
+/**
+ * @brief Fecha del calendario.
+ */
+typedef struct {
+    uint16_t year;   // Año, entre CLOCK_MIN_YEAR y CLOCK_MAX_YEAR
+    uint8_t month;   // Mes, de 1 a 12
+    uint8_t day;     // Dia del mes, desde 1
+    uint8_t weekday; // Dia de la semana, ver clock_weekday_t. Se calcula a partir de la fecha y se ignora al ajustarla
+} clock_date_t;
+
+/**
+ * @brief Eventos del reloj que se pueden esperar.
+ *
+ * Los valores son banderas que se pueden combinar con el operador | para esperar varios eventos a la vez.
+ */
+typedef enum {
+    CLOCK_EVENT_SECOND = (1 << 0), // Comienza un nuevo segundo
+    CLOCK_EVENT_MINUTE = (1 << 1), // Cambia el minuto, que es lo que muestra la pantalla
+    CLOCK_EVENT_ALARM = (1 << 2),  // Vence la alarma o la alarma pospuesta
+} clock_event_t;
+
+/**
+ * @brief Función que atiende los eventos del reloj.
+ *
+ * Se llama desde ClockNewTick o ClockAdvanceTicks, después de actualizar el reloj, por lo que puede consultarlo. Debe
+ * ser breve, por ejemplo enviar una notificación o un mensaje a la tarea que procesa el evento.
+ *
+ * @param clock Puntero al reloj que generó los eventos.
+ * @param events Eventos ocurridos desde la llamada anterior, combinación de valores de clock_event_t.
+ * @param object Puntero a los datos de usuario indicados al instalar la función.
+ */
+typedef void (*clock_event_handler_t)(clock_t clock, uint8_t events, void * object);
+
 /*Constructor de reloj
+ * Toma el reloj de una reserva estática de CLOCK_MAX_INSTANCES elementos, no usa memoria dinámica. Se debe llamar
+ * durante la inicialización, antes de que otras tareas puedan crear relojes.
  * @param ticks_per_second Frecuencia del reloj en ticks por segundo.
- * @return Un puntero a una instancia de reloj inicializada.
+ * @return Un puntero a una instancia de reloj inicializada, o NULL si la reserva está agotada.
  */
 clock_t ClockCreate(uint16_t ticks_per_second);
 
+/**
+ * @brief Crea un reloj en la memoria indicada por la aplicación.
+ *
+ * @param storage Memoria donde se guarda el reloj, debe existir mientras se use el reloj.
+ * @param ticks_per_second Frecuencia del reloj en ticks por segundo.
+ * @return Un puntero a una instancia de reloj inicializada, o NULL si los parámetros no son válidos.
+ */
+clock_t ClockCreateStatic(clock_storage_t * storage, uint16_t ticks_per_second);
+
 /**
  * @brief Obtiene la hora actual del reloj.
  *
@@ -125,6 +237,57 @@ bool ClockSetAlarmTime(clock_t clock, const clock_time_t * alarm_time);
  */
 void ClockNewTick(clock_t clock);
 
+/**
+ * @brief Avanza el reloj una cantidad arbitraria de ticks en tiempo constante.
+ *
+ * Equivale a llamar ClockNewTick la cantidad de veces indicada, pero sin recorrer cada tick. Permite recuperar los
+ * ticks perdidos cuando la tarea del reloj se demora.
+ *
+ * @param clock Puntero al reloj que se desea actualizar.
+ * @param ticks Cantidad de ticks a avanzar.
+ * @return true si la hora de la alarma o de la alarma pospuesta quedó dentro del intervalo avanzado, false en caso
+ * contrario o si el reloj es NULL o no tiene una hora válida.
+ */
+bool ClockAdvanceTicks(clock_t clock, uint32_t ticks);
+
+/**
+ * @brief Calcula cuantos ticks faltan para el próximo evento del reloj.
+ *
+ * Permite que la tarea del reloj se bloquee exactamente ese tiempo y luego llame a ClockAdvanceTicks, en lugar de
+ * despertarse en cada tick.
+ *
+ * @param clock Puntero al reloj que se desea consultar.
+ * @param events Combinación de valores clock_event_t con los eventos que interesan.
+ * @return Cantidad de ticks hasta el primero de los eventos pedidos. Si el reloj no tiene una hora válida o no se pidió
+ * ningún evento posible devuelve los ticks hasta el próximo segundo. Devuelve 0 si el reloj es NULL.
+ */
+uint32_t ClockTicksUntilNextEvent(clock_t clock, uint8_t events);
+
+/**
+ * @brief Instala una función para atender los eventos del reloj en lugar de consultarlo periódicamente.
+ *
+ * @param clock Puntero al reloj que genera los eventos.
+ * @param handler Función que se llama cuando ocurre alguno de los eventos, o NULL para no atenderlos.
+ * @param object Puntero a los datos de usuario que recibe la función en cada llamada.
+ * @param events Eventos que se desean atender, combinación de valores de clock_event_t.
+ * @return true si la operación fue exitosa, false si el reloj es NULL.
+ */
+bool ClockSetEventHandler(clock_t clock, clock_event_handler_t handler, void * object, uint8_t events);
+
+/**
+ * @brief Corrige el error de frecuencia de la fuente de ticks del reloj.
+ *
+ * La duración de cada segundo pasa a ser ticks_per_second * (1 + ppm / 1000000) ticks. Como no es un número entero,
+ * cada segundo dura el valor ideal redondeado hacia arriba o hacia abajo y la fracción se acumula para el segundo
+ * siguiente, así el reloj no se atrasa ni se adelanta con el tiempo.
+ *
+ * @param clock Puntero al reloj que se desea calibrar.
+ * @param ppm Error de la fuente de ticks en partes por millón, positivo si entrega más ticks de los nominales por
+ * segundo y negativo si entrega menos. Debe estar entre -CLOCK_MAX_CALIBRATION_PPM y CLOCK_MAX_CALIBRATION_PPM.
+ * @return true si la calibración se aplicó, false si el valor está fuera de rango.
+ */
+bool ClockSetCalibration(clock_t clock, int32_t ppm);
+
 /**
  * @brief Obtiene la hora de la alarma del reloj.
  *
@@ -164,6 +327,96 @@ bool ClockIsAlarmEnabled(clock_t clock);
  */
 bool ClockIsAlarmTriggered(clock_t clock);
 
+/**
+ * @brief Agrega una alarma habilitada a la tabla de alarmas del reloj.
+ *
+ * @param clock Puntero al reloj donde se desea agregar la alarma.
+ * @param alarm_time Puntero a la hora de vencimiento de la alarma.
+ * @return Identificador de la nueva alarma, o CLOCK_INVALID_ALARM si la hora es inválida o la tabla está llena.
+ */
+uint8_t ClockAddAlarm(clock_t clock, const clock_time_t * alarm_time);
+
+/**
+ * @brief Elimina una alarma de la tabla junto con sus alarmas pospuestas.
+ *
+ * @param clock Puntero al reloj donde se desea eliminar la alarma.
+ * @param id Identificador de la alarma. La alarma principal no se puede eliminar.
+ * @return true si la alarma fue eliminada, false si no existe o es la alarma principal.
+ */
+bool ClockRemoveAlarm(clock_t clock, uint8_t id);
+
+/**
+ * @brief Habilita una alarma de la tabla.
+ *
+ * @param clock Puntero al reloj donde se desea habilitar la alarma.
+ * @param id Identificador de la alarma.
+ * @return true si la operación fue exitosa, false si la alarma no existe.
+ */
+bool ClockEnableAlarmById(clock_t clock, uint8_t id);
+
+/**
+ * @brief Deshabilita una alarma de la tabla y descarta sus alarmas pospuestas.
+ *
+ * @param clock Puntero al reloj donde se desea deshabilitar la alarma.
+ * @param id Identificador de la alarma.
+ * @return true si la operación fue exitosa, false si la alarma no existe.
+ */
+bool ClockDisableAlarmById(clock_t clock, uint8_t id);
+
+/**
+ * @brief Obtiene la cantidad de alarmas cargadas en la tabla, incluyendo las alarmas pospuestas.
+ *
+ * @param clock Puntero al reloj que se desea consultar.
+ * @return Cantidad de alarmas en la tabla.
+ */
+uint8_t ClockGetAlarmCount(clock_t clock);
+
+/**
+ * @brief Obtiene la descripción de una alarma de la tabla, ordenadas por hora de vencimiento.
+ *
+ * @param clock Puntero al reloj que se desea consultar.
+ * @param index Posición de la alarma en la tabla, de 0 a ClockGetAlarmCount() - 1.
+ * @param info Puntero donde se almacenará la descripción de la alarma.
+ * @return true si la operación fue exitosa, false si el indice está fuera de la tabla.
+ */
+bool ClockGetAlarm(clock_t clock, uint8_t index, clock_alarm_info_t * info);
+
+/**
+ * @brief Cambia los días de la semana en que suena una alarma de la tabla.
+ *
+ * @param clock Puntero al reloj donde se desea modificar la alarma.
+ * @param id Identificador de la alarma.
+ * @param weekdays Máscara con un bit por día de la semana, armada con CLOCK_DAY_MASK o CLOCK_EVERY_DAY.
+ * @return true si la operación fue exitosa, false si la alarma no existe o la máscara es inválida.
+ */
+bool ClockSetAlarmWeekdays(clock_t clock, uint8_t id, uint8_t weekdays);
+
+/**
+ * @brief Ajusta la fecha del reloj.
+ *
+ * @param clock Puntero al reloj que se desea ajustar.
+ * @param date Puntero a la nueva fecha, el día de la semana se calcula a partir de ella.
+ * @return true si la fecha es válida y se ajustó, false en caso contrario.
+ */
+bool ClockSetDate(clock_t clock, const clock_date_t * date);
+
+/**
+ * @brief Obtiene la fecha actual del reloj.
+ *
+ * @param clock Puntero al reloj que se desea consultar.
+ * @param date Puntero donde se almacenará la fecha actual.
+ * @return true si la operación fue exitosa, false en caso contrario.
+ */
+bool ClockGetDate(clock_t clock, clock_date_t * date);
+
+/**
+ * @brief Obtiene el día de la semana de la fecha actual sin calcular el resto de la fecha.
+ *
+ * @param clock Puntero al reloj que se desea consultar.
+ * @return Día de la semana, ver clock_weekday_t.
+ */
+uint8_t ClockGetWeekday(clock_t clock);
+
 /**
  * @brief Compara dos tiempos del reloj para verificar si son iguales.
  *
@@ -185,12 +438,31 @@ bool ClockSnoozeAlarm(clock_t self, uint8_t minutes_to_snooze);
 /**
  * @brief Cancela la alarma del reloj hasta el próximo día.
  *
- * Esta función detiene el sonido actual de la alarma y desactiva la alarma pospuesta.
+ * Esta función detiene el sonido actual de la alarma y descarta sus alarmas pospuestas, las de otras alarmas se
+ * mantienen. Como cada alarma suena una sola vez por día, no vuelve a sonar hasta su próximo vencimiento en un día
+ * incluido en su máscara.
  *
  * @param self Puntero al reloj donde se desea cancelar la alarma.
  * @return true si la operación fue exitosa, false si el reloj es NULL o no es válido.
  */
 bool ClockCancelAlarmUntilNextDay(clock_t self);
+
+#ifdef CLOCK_CRITICAL_HOOKS
+/**
+ * @brief Impide que otra tarea ejecute mientras se modifica el reloj, la debe implementar la aplicación.
+ *
+ * Con un solo núcleo una tarea de mayor prioridad que interrumpa una escritura esperaría para siempre a que termine,
+ * por eso las escrituras del reloj no se deben poder interrumpir. Con FreeRTOS alcanza con vTaskSuspendAll, ya que las
+ * funciones del reloj no se llaman desde interrupciones.
+ */
+void ClockCriticalEnter(void);
+
+/**
+ * @brief Permite nuevamente el cambio de tarea al terminar una modificación del reloj.
+ */
+void ClockCriticalExit(void);
+#endif
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -38,6 +38,51 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+#ifndef DIGITAL_MAX_OUTPUTS
+#define DIGITAL_MAX_OUTPUTS 4 // Cantidad de salidas que puede entregar DigitalOutputCreate sin memoria del usuario
+#endif
+
+#ifndef DIGITAL_MAX_INPUTS
+#define DIGITAL_MAX_INPUTS 6 // Cantidad de entradas que puede entregar DigitalInputCreate sin memoria del usuario
+#endif
+
+#ifndef DIGITAL_MAX_GROUPS
+#define DIGITAL_MAX_GROUPS 1 // Cantidad de grupos que puede entregar DigitalInputGroupCreate sin memoria del usuario
+#endif
+
+#define DIGITAL_GROUP_MAX_PORTS 2 // Puertos que puede leer un grupo, cada uno ocupa 32 bits de digital_keys_t
+
+#ifndef DIGITAL_DEBOUNCE_PLANES
+#define DIGITAL_DEBOUNCE_PLANES 3 // Bits de los contadores verticales del antirrebote de un grupo
+#endif
+
+#define DIGITAL_DEBOUNCE_MAX_SAMPLES ((1U << DIGITAL_DEBOUNCE_PLANES) - 1U) // Muestras máximas para aceptar un cambio
+
+#ifndef DIGITAL_MAX_OUTPUT_GROUPS
+#define DIGITAL_MAX_OUTPUT_GROUPS 1 // Grupos de salidas que puede entregar DigitalOutputGroupCreate sin memoria
+#endif
+
+#define DIGITAL_OUTPUT_GROUP_MAX_OUTPUTS 8 // Salidas de un grupo, cada una ocupa un bit de digital_outputs_t
+#define DIGITAL_OUTPUT_GROUP_MAX_PORTS   4 // Puertos distintos que puede escribir un grupo de salidas
+
+#ifndef DIGITAL_MAX_GESTURES
+#define DIGITAL_MAX_GESTURES 1 // Cantidad de reconocedores que puede entregar DigitalGesturesCreate sin memoria
+#endif
+
+#define DIGITAL_GESTURE_MAX_KEYS 8 // Teclas que puede seguir un reconocedor de gestos
+#define DIGITAL_GESTURE_QUEUE    8 // Gestos que puede guardar un reconocedor hasta que se lean
+
+#define DIGITAL_GESTURE_OPTION_DOUBLE (1 << 0) // Reconoce la doble presión, la presión corta espera a descartarla
+#define DIGITAL_GESTURE_OPTION_REPEAT (1 << 1) // Mantenida repite con ritmo creciente, en lugar de la presión larga
+
+#define DIGITAL_OUTPUT_STORAGE_SIZE 3  // Bytes que ocupa una salida digital
+#define DIGITAL_INPUT_STORAGE_SIZE  4  // Bytes que ocupa una entrada digital
+#define DIGITAL_GROUP_STORAGE_SIZE  (48 + 8 * DIGITAL_DEBOUNCE_PLANES) // Bytes que ocupa un grupo de entradas
+#define DIGITAL_OUTPUT_GROUP_STORAGE_SIZE 48 // Bytes que ocupa un grupo de salidas
+
+// Bytes que ocupa un reconocedor de gestos, seis por tecla y dos por gesto en la cola
+#define DIGITAL_GESTURES_STORAGE_SIZE (16 + 6 * DIGITAL_GESTURE_MAX_KEYS + 2 * DIGITAL_GESTURE_QUEUE)
+
 /* === Public data type declarations =============================================================================== */
 
 /**
@@ -60,19 +105,123 @@ typedef struct digital_output_s * digital_output_t;
  */
 typedef struct digital_input_s * digital_input_t;
 
+/** @brief Grupo de entradas digitales que se leen juntas, un acceso por puerto en cada muestreo.
+ * @details Se debe usar desde una sola tarea.
+ */
+typedef struct digital_input_group_s * digital_input_group_t;
+
+/** @brief Máscara de entradas de un grupo, cada entrada ocupa el bit de su terminal en los 32 bits de su puerto.
+ */
+typedef uint64_t digital_keys_t;
+
+/** @brief Grupo de salidas digitales que se escriben juntas, un acceso a SET y uno a CLR por puerto.
+ * @details Se debe usar desde una sola tarea.
+ */
+typedef struct digital_output_group_s * digital_output_group_t;
+
+/** @brief Estado de las salidas de un grupo, cada salida ocupa el bit que le asignó DigitalOutputGroupAdd.
+ */
+typedef uint8_t digital_outputs_t;
+
+/** @brief Reconocedor de gestos sobre las teclas de un grupo.
+ * @details Se debe usar desde una sola tarea.
+ */
+typedef struct digital_gestures_s * digital_gestures_t;
+
+/** @brief Gestos que puede reconocer una tecla.
+ */
+typedef enum digital_gesture_kind_e {
+    DIGITAL_GESTURE_PRESS = 1,    // Presión corta, se entrega al soltar la tecla
+    DIGITAL_GESTURE_LONG_PRESS,   // La tecla se mantuvo el tiempo de presión larga, se entrega sin esperar a soltarla
+    DIGITAL_GESTURE_DOUBLE_PRESS, // Segunda presión dentro de la ventana, se entrega al presionar
+    DIGITAL_GESTURE_REPEAT,       // Repetición de una tecla mantenida
+} digital_gesture_kind_t;
+
+/** @brief Gesto reconocido en una tecla.
+ */
+typedef struct digital_gesture_s {
+    digital_keys_t key;          // Máscara de la tecla en el grupo
+    digital_gesture_kind_t kind; // Gesto reconocido
+} digital_gesture_t;
+
+/** @brief Tiempos de un reconocedor de gestos, en las unidades del tiempo que recibe DigitalGesturesUpdate.
+ */
+typedef struct digital_gestures_timing_s {
+    uint16_t long_press;    // Tiempo que se mantiene una tecla para la presión larga
+    uint16_t double_press;  // Tiempo máximo entre soltar y volver a presionar para la doble presión
+    uint16_t repeat_delay;  // Tiempo que se mantiene una tecla hasta la primera repetición
+    uint16_t repeat_period; // Tiempo entre las primeras repeticiones, se acorta un octavo en cada una
+    uint16_t repeat_min;    // Tiempo mínimo entre repeticiones
+} digital_gestures_timing_t;
+
+/** @brief Memoria para crear una salida digital con DigitalOutputCreateStatic.
+ * @details Su contenido es privado del modulo, solo se declara para que la aplicación pueda reservarla en forma
+ * estática.
+ */
+typedef struct {
+    uint8_t reserved[DIGITAL_OUTPUT_STORAGE_SIZE];
+} digital_output_storage_t;
+
+/** @brief Memoria para crear una entrada digital con DigitalInputCreateStatic.
+ * @details Su contenido es privado del modulo, solo se declara para que la aplicación pueda reservarla en forma
+ * estática.
+ */
+typedef struct {
+    uint8_t reserved[DIGITAL_INPUT_STORAGE_SIZE];
+} digital_input_storage_t;
+
+/** @brief Memoria para crear un grupo de entradas con DigitalInputGroupCreateStatic.
+ * @details Su contenido es privado del modulo, solo se declara para que la aplicación pueda reservarla en forma
+ * estática.
+ */
+typedef union {
+    uint8_t reserved[DIGITAL_GROUP_STORAGE_SIZE];
+    uint64_t align; // Garantiza la alineación que requiere la estructura interna del grupo
+} digital_input_group_storage_t;
+
+/** @brief Memoria para crear un grupo de salidas con DigitalOutputGroupCreateStatic.
+ * @details Su contenido es privado del modulo, solo se declara para que la aplicación pueda reservarla en forma
+ * estática.
+ */
+typedef union {
+    uint8_t reserved[DIGITAL_OUTPUT_GROUP_STORAGE_SIZE];
+    uint32_t align; // Garantiza la alineación que requiere la estructura interna del grupo
+} digital_output_group_storage_t;
+
+/** @brief Memoria para crear un reconocedor de gestos con DigitalGesturesCreateStatic.
+ * @details Su contenido es privado del modulo, solo se declara para que la aplicación pueda reservarla en forma
+ * estática.
+ */
+typedef union {
+    uint8_t reserved[DIGITAL_GESTURES_STORAGE_SIZE];
+    uint16_t align; // Garantiza la alineación que requiere la estructura interna del reconocedor
+} digital_gestures_storage_t;
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
 
 /**
  * @brief Crea una salida digital.
+ * @details Toma la salida de una reserva estática de DIGITAL_MAX_OUTPUTS elementos, no usa memoria dinámica.
  * @param gpio El número del GPIO asociado a la salida.
  * @param bit El bit específico del GPIO que se utilizará.
  * @param inverted Indica si la salida está invertida (true) o no (false).
- * @return Un identificador para la salida digital creada.
+ * @return Un identificador para la salida digital creada, o NULL si la reserva está agotada.
  */
 digital_output_t DigitalOutputCreate(uint8_t gpio, uint8_t bit, bool inverted);
 
+/**
+ * @brief Crea una salida digital en la memoria indicada por la aplicación.
+ * @param storage Memoria donde se guarda la salida, debe existir mientras se use la salida.
+ * @param gpio El número del GPIO asociado a la salida.
+ * @param bit El bit específico del GPIO que se utilizará.
+ * @param inverted Indica si la salida está invertida (true) o no (false).
+ * @return Un identificador para la salida digital creada, o NULL si no se indicó la memoria.
+ */
+digital_output_t DigitalOutputCreateStatic(digital_output_storage_t * storage, uint8_t gpio, uint8_t bit,
+                                           bool inverted);
+
 /**
  * @brief Libera los recursos asociados a una salida digital.
  * @param output El identificador de la salida digital a liberar.
@@ -95,15 +244,59 @@ void DigitalOutputDeactivate(digital_output_t output);
  */
 void DigitalOutputToggle(digital_output_t output);
 
+/**
+ * @brief Crea un grupo de salidas vacío.
+ * @details Toma el grupo de una reserva estática de DIGITAL_MAX_OUTPUT_GROUPS elementos, no usa memoria dinámica.
+ * @return Un identificador para el grupo creado, o NULL si la reserva está agotada.
+ */
+digital_output_group_t DigitalOutputGroupCreate(void);
+
+/**
+ * @brief Crea un grupo de salidas vacío en la memoria indicada por la aplicación.
+ * @param storage Memoria donde se guarda el grupo, debe existir mientras se use el grupo.
+ * @return Un identificador para el grupo creado, o NULL si no se indicó la memoria.
+ */
+digital_output_group_t DigitalOutputGroupCreateStatic(digital_output_group_storage_t * storage);
+
+/**
+ * @brief Agrega una salida al grupo, sin cambiar su estado.
+ * @details La polaridad de la salida se incorpora a las máscaras del grupo, que la escribe con el mismo nivel que
+ * DigitalOutputActivate y DigitalOutputDeactivate.
+ * @param group Identificador del grupo.
+ * @param output Salida a agregar.
+ * @return Bit de la salida en el estado del grupo, o 0 si el grupo está lleno o su puerto no entra en el grupo.
+ */
+digital_outputs_t DigitalOutputGroupAdd(digital_output_group_t group, digital_output_t output);
+
+/**
+ * @brief Escribe a la vez las salidas indicadas, con una escritura de SET y una de CLR en cada puerto.
+ * @details Las salidas de un mismo puerto cambian en el mismo instante, sin estados intermedios visibles.
+ * @param group Identificador del grupo.
+ * @param outputs Máscara de las salidas que se escriben, las demás no cambian.
+ * @param active Máscara de las salidas que quedan activas, las demás de outputs se desactivan.
+ */
+void DigitalOutputGroupWrite(digital_output_group_t group, digital_outputs_t outputs, digital_outputs_t active);
+
 /**
  * @brief Crea una entrada digital.
+ * @details Toma la entrada de una reserva estática de DIGITAL_MAX_INPUTS elementos, no usa memoria dinámica.
  * @param gpio El número del GPIO asociado a la entrada.
  * @param bit El bit específico del GPIO que se utilizará.
  * @param inverted Indica si la entrada está invertida (true) o no (false).
- * @return Un identificador para la entrada digital creada.
+ * @return Un identificador para la entrada digital creada, o NULL si la reserva está agotada.
  */
 digital_input_t DigitalInputCreate(uint8_t gpio, uint8_t bit, bool inverted);
 
+/**
+ * @brief Crea una entrada digital en la memoria indicada por la aplicación.
+ * @param storage Memoria donde se guarda la entrada, debe existir mientras se use la entrada.
+ * @param gpio El número del GPIO asociado a la entrada.
+ * @param bit El bit específico del GPIO que se utilizará.
+ * @param inverted Indica si la entrada está invertida (true) o no (false).
+ * @return Un identificador para la entrada digital creada, o NULL si no se indicó la memoria.
+ */
+digital_input_t DigitalInputCreateStatic(digital_input_storage_t * storage, uint8_t gpio, uint8_t bit, bool inverted);
+
 /**
  * @brief Permite saber si la entrada digital está activa.
  *
@@ -144,6 +337,144 @@ bool DigitalInputWasDeactivated(digital_input_t input);
  */
 digital_states_t DigitalInputWasChanged(digital_input_t input);
 
+/**
+ * @brief Crea un grupo de entradas vacío.
+ * @details Toma el grupo de una reserva estática de DIGITAL_MAX_GROUPS elementos, no usa memoria dinámica.
+ * @return Un identificador para el grupo creado, o NULL si la reserva está agotada.
+ */
+digital_input_group_t DigitalInputGroupCreate(void);
+
+/**
+ * @brief Crea un grupo de entradas vacío en la memoria indicada por la aplicación.
+ * @param storage Memoria donde se guarda el grupo, debe existir mientras se use el grupo.
+ * @return Un identificador para el grupo creado, o NULL si no se indicó la memoria.
+ */
+digital_input_group_t DigitalInputGroupCreateStatic(digital_input_group_storage_t * storage);
+
+/**
+ * @brief Agrega una entrada al grupo, que toma su estado actual como punto de partida para detectar flancos.
+ * @param group Identificador del grupo.
+ * @param input Entrada a agregar, puede estar en cualquiera de los DIGITAL_GROUP_MAX_PORTS puertos del grupo.
+ * @return Máscara de la entrada en el grupo, o 0 si su puerto no entra en el grupo.
+ */
+digital_keys_t DigitalInputGroupAdd(digital_input_group_t group, digital_input_t input);
+
+/**
+ * @brief Configura cuántas muestras seguidas tiene que durar un cambio de una entrada para que el grupo lo acepte.
+ * @details Todas las entradas del grupo se filtran a la vez con contadores verticales, un plano de bits por cada bit
+ * del contador y por cada puerto. El tiempo de filtrado es la cantidad de muestras por el período con el que se llama a
+ * DigitalInputGroupScan. Un grupo recién creado acepta los cambios en la primera muestra.
+ * @param group Identificador del grupo.
+ * @param samples Muestras que tiene que durar un cambio, de 1 a DIGITAL_DEBOUNCE_MAX_SAMPLES.
+ * @return true si se configuró el filtro, false si la cantidad de muestras está fuera de rango.
+ */
+bool DigitalInputGroupSetDebounce(digital_input_group_t group, uint8_t samples);
+
+/**
+ * @brief Devuelve la máscara de una entrada del grupo.
+ * @param group Identificador del grupo.
+ * @param input Entrada agregada antes con DigitalInputGroupAdd.
+ * @return Máscara de la entrada en el grupo, o 0 si la entrada no está en el grupo.
+ */
+digital_keys_t DigitalInputGroupKey(digital_input_group_t group, digital_input_t input);
+
+/**
+ * @brief Lee una vez cada puerto del grupo, filtra los rebotes y calcula los flancos de todas sus entradas a la vez.
+ * @details El costo depende solo de la cantidad de puertos y de DIGITAL_DEBOUNCE_PLANES. Los flancos reemplazan a
+ * los del muestreo anterior, los que no se atendieron se pierden.
+ * @param group Identificador del grupo.
+ */
+void DigitalInputGroupScan(digital_input_group_t group);
+
+/**
+ * @brief Indica si las entradas del grupo están quietas, para dejar de muestrear hasta el próximo flanco.
+ * @details Lee una vez cada puerto sin modificar el estado, los flancos ni los contadores del antirrebote del grupo.
+ * @param group Identificador del grupo.
+ * @return true si ninguna entrada tiene un cambio en curso y todas las lecturas coinciden con el estado filtrado.
+ */
+bool DigitalInputGroupIsSettled(digital_input_group_t group);
+
+/**
+ * @brief Devuelve las entradas que estaban activas en el último muestreo.
+ * @param group Identificador del grupo.
+ * @return Máscara de las entradas activas, sin importar si son de lógica invertida o no.
+ */
+digital_keys_t DigitalInputGroupActive(digital_input_group_t group);
+
+/**
+ * @brief Devuelve las entradas que se activaron en el último muestreo y todavía no se consumieron.
+ * @details Consultar los flancos no los consume, se pueden consultar en varias ramas del mismo ciclo.
+ * @param group Identificador del grupo.
+ * @return Máscara de las entradas que se activaron.
+ */
+digital_keys_t DigitalInputGroupActivated(digital_input_group_t group);
+
+/**
+ * @brief Devuelve las entradas que se desactivaron en el último muestreo y todavía no se consumieron.
+ * @details Consultar los flancos no los consume, se pueden consultar en varias ramas del mismo ciclo.
+ * @param group Identificador del grupo.
+ * @return Máscara de las entradas que se desactivaron.
+ */
+digital_keys_t DigitalInputGroupDeactivated(digital_input_group_t group);
+
+/**
+ * @brief Consume los flancos de las entradas indicadas, para que no los atienda otra parte del programa.
+ * @param group Identificador del grupo.
+ * @param keys Máscara de las entradas cuyos flancos se consumen.
+ */
+void DigitalInputGroupConsume(digital_input_group_t group, digital_keys_t keys);
+
+/**
+ * @brief Crea un reconocedor de gestos sin teclas.
+ * @details Toma el reconocedor de una reserva estática de DIGITAL_MAX_GESTURES elementos, no usa memoria dinámica.
+ * @param timing Tiempos de los gestos, se copian al crear el reconocedor.
+ * @return Un identificador para el reconocedor creado, o NULL si la reserva está agotada.
+ */
+digital_gestures_t DigitalGesturesCreate(const digital_gestures_timing_t * timing);
+
+/**
+ * @brief Crea un reconocedor de gestos sin teclas en la memoria indicada por la aplicación.
+ * @param storage Memoria donde se guarda el reconocedor, debe existir mientras se use.
+ * @param timing Tiempos de los gestos, se copian al crear el reconocedor.
+ * @return Un identificador para el reconocedor creado, o NULL si no se indicó la memoria.
+ */
+digital_gestures_t DigitalGesturesCreateStatic(digital_gestures_storage_t * storage,
+                                               const digital_gestures_timing_t * timing);
+
+/**
+ * @brief Agrega una tecla al reconocedor.
+ * @details Todas las teclas reconocen la presión corta. Las que no repiten reconocen además la presión larga.
+ * @param gestures Identificador del reconocedor.
+ * @param key Máscara de la tecla, obtenida de DigitalInputGroupKey.
+ * @param options Combinación de DIGITAL_GESTURE_OPTION_DOUBLE y DIGITAL_GESTURE_OPTION_REPEAT.
+ * @return true si se agregó la tecla, false si el reconocedor está lleno o la máscara está vacía.
+ */
+bool DigitalGesturesAdd(digital_gestures_t gestures, digital_keys_t key, uint8_t options);
+
+/**
+ * @brief Avanza el reconocimiento de todas las teclas y encola los gestos reconocidos.
+ * @details Si la cola está llena los gestos nuevos se descartan.
+ * @param gestures Identificador del reconocedor.
+ * @param pressed Máscara de las teclas presionadas, normalmente las entradas activas de un grupo ya filtrado.
+ * @param now Tiempo actual, con las mismas unidades que los tiempos de los gestos.
+ */
+void DigitalGesturesUpdate(digital_gestures_t gestures, digital_keys_t pressed, uint32_t now);
+
+/**
+ * @brief Saca de la cola el gesto más antiguo.
+ * @param gestures Identificador del reconocedor.
+ * @param gesture Variable donde se devuelve el gesto.
+ * @return true si había un gesto en la cola, false si estaba vacía.
+ */
+bool DigitalGesturesNext(digital_gestures_t gestures, digital_gesture_t * gesture);
+
+/**
+ * @brief Indica si ningún gesto depende del paso del tiempo, para dejar de actualizar hasta el próximo flanco.
+ * @param gestures Identificador del reconocedor.
+ * @return true si todas las teclas están sueltas o mantenidas después de una presión larga o doble.
+ */
+bool DigitalGesturesIsIdle(digital_gestures_t gestures);
+
 /* === End of conditional blocks =================================================================================== */
 #ifdef __cplusplus
 }
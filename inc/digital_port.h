@@ -0,0 +1,189 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef DIGITAL_PORT_H_
+#define DIGITAL_PORT_H_
+
+/** @file digital_port.h
+ ** @brief Acceso en línea a los terminales y puertos que usan las entradas, las salidas y la pantalla.
+ ** @details Los terminales se identifican con el par puerto gpio y bit de poncho.h. En el LPC43xx cada función es la
+ ** misma escritura o lectura de registro que hacían los módulos con las funciones de chip.h. Si se compila con POSIX
+ ** cada terminal se traduce con el mapa de la placa a un terminal emulado de hal_gpio, y las operaciones sobre un
+ ** puerto recorren los bits de la máscara.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef POSIX
+#include "hal_gpio.h"
+#else
+#include "chip.h"
+#endif
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+#ifdef POSIX
+
+/**
+ * @brief Mapa de terminales de la placa, lo define el bsp de cada placa que usa hal_gpio.
+ * @param gpio Puerto del terminal, como en poncho.h.
+ * @param bit Bit del terminal en el puerto, como en poncho.h.
+ * @return Terminal emulado que corresponde, o NULL si la placa no lo tiene.
+ */
+hal_gpio_bit_t BoardPinMap(uint8_t gpio, uint8_t bit);
+
+/**
+ * @brief Configura un terminal como entrada o como salida.
+ */
+static inline void DigitalPinSetDirection(uint8_t gpio, uint8_t bit, bool output) {
+    GpioSetDirection(BoardPinMap(gpio, bit), output);
+}
+
+/**
+ * @brief Escribe el nivel de un terminal de salida.
+ */
+static inline void DigitalPinWrite(uint8_t gpio, uint8_t bit, bool state) {
+    GpioSetState(BoardPinMap(gpio, bit), state);
+}
+
+/**
+ * @brief Invierte el nivel de un terminal de salida.
+ */
+static inline void DigitalPinToggle(uint8_t gpio, uint8_t bit) {
+    GpioBitToggle(BoardPinMap(gpio, bit));
+}
+
+/**
+ * @brief Lee el nivel de un terminal.
+ */
+static inline bool DigitalPinRead(uint8_t gpio, uint8_t bit) {
+    return GpioGetState(BoardPinMap(gpio, bit));
+}
+
+/**
+ * @brief Lee todos los bits de un puerto, los que la placa no tiene se leen en cero.
+ */
+static inline uint32_t DigitalPortRead(uint8_t gpio) {
+    uint32_t result = 0;
+
+    for (uint8_t bit = 0; bit < 32; bit++) {
+        if (GpioGetState(BoardPinMap(gpio, bit))) {
+            result |= (1UL << bit);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Pone en alto los bits de un puerto indicados por la máscara.
+ */
+static inline void DigitalPortSet(uint8_t gpio, uint32_t mask) {
+    for (uint8_t bit = 0; mask != 0; bit++, mask >>= 1) {
+        if (mask & 1) {
+            GpioBitSet(BoardPinMap(gpio, bit));
+        }
+    }
+}
+
+/**
+ * @brief Pone en bajo los bits de un puerto indicados por la máscara.
+ */
+static inline void DigitalPortClear(uint8_t gpio, uint32_t mask) {
+    for (uint8_t bit = 0; mask != 0; bit++, mask >>= 1) {
+        if (mask & 1) {
+            GpioBitClear(BoardPinMap(gpio, bit));
+        }
+    }
+}
+
+#else
+
+/**
+ * @brief Configura un terminal como entrada o como salida.
+ */
+static inline void DigitalPinSetDirection(uint8_t gpio, uint8_t bit, bool output) {
+    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, gpio, bit, output);
+}
+
+/**
+ * @brief Escribe el nivel de un terminal de salida.
+ */
+static inline void DigitalPinWrite(uint8_t gpio, uint8_t bit, bool state) {
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, gpio, bit, state);
+}
+
+/**
+ * @brief Invierte el nivel de un terminal de salida.
+ */
+static inline void DigitalPinToggle(uint8_t gpio, uint8_t bit) {
+    Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, gpio, bit);
+}
+
+/**
+ * @brief Lee el nivel de un terminal.
+ */
+static inline bool DigitalPinRead(uint8_t gpio, uint8_t bit) {
+    return Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, gpio, bit) != 0;
+}
+
+/**
+ * @brief Lee todos los bits de un puerto.
+ */
+static inline uint32_t DigitalPortRead(uint8_t gpio) {
+    return Chip_GPIO_GetPortValue(LPC_GPIO_PORT, gpio);
+}
+
+/**
+ * @brief Pone en alto los bits de un puerto indicados por la máscara.
+ */
+static inline void DigitalPortSet(uint8_t gpio, uint32_t mask) {
+    Chip_GPIO_SetValue(LPC_GPIO_PORT, gpio, mask);
+}
+
+/**
+ * @brief Pone en bajo los bits de un puerto indicados por la máscara.
+ */
+static inline void DigitalPortClear(uint8_t gpio, uint32_t mask) {
+    Chip_GPIO_ClearValue(LPC_GPIO_PORT, gpio, mask);
+}
+
+#endif
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIGITAL_PORT_H_ */
@@ -42,7 +42,9 @@
  ** @{ */
 
 /* === Headers files inclusions ================================================================ */
+#ifndef POSIX
 #include "chip.h"
+#endif
 
 /* === Cabecera C++ ============================================================================ */
 
@@ -46,14 +46,60 @@ extern "C" {
 #define SEGMENT_G (1 << 6)
 #define SEGMENT_P (1 << 7)
 
+#ifndef SCREEN_MAX_DIGITS
+#define SCREEN_MAX_DIGITS 8 // Cantidad máxima de dígitos que puede manejar una pantalla
+#endif
+
+#ifndef SCREEN_MAX_INSTANCES
+#define SCREEN_MAX_INSTANCES 1 // Cantidad de pantallas que puede entregar ScreenCreate sin memoria del usuario
+#endif
+
+#ifndef SCREEN_BLINK_GROUPS
+#define SCREEN_BLINK_GROUPS 2 // Grupos de parpadeo independientes, cada uno con su propia velocidad
+#endif
+
+#define SCREEN_BLINK_MAX_SHIFT 15 // Mayor exponente aceptado por ScreenSetBlink
+
+#define SCREEN_DIGIT_WORDS 4 // Palabras que puede precalcular el controlador para encender cada dígito
+
+#ifndef SCREEN_MARQUEE_LENGTH
+#define SCREEN_MARQUEE_LENGTH 32 // Lugares del anillo de la marquesina, el texto más dos veces la cantidad de dígitos
+#endif
+
+// Bytes que ocupa una pantalla, el modulo verifica al compilar que alcancen para su estructura interna
+#define SCREEN_STORAGE_SIZE                                                                                            \
+    (sizeof(void *) + 11 + 2 * SCREEN_MAX_DIGITS + 5 * SCREEN_MAX_DIGITS * sizeof(screen_digit_masks_t) +             \
+     4 * SCREEN_BLINK_GROUPS + SCREEN_MARQUEE_LENGTH)
+
 /* === Public data type declarations =============================================================================== */
 
 /*
  * @brief Estructura que representa el estado de un dígito en la pantalla de 7 segmentos.
- * @details Esta estructura contiene un valor BCD y un indicador de punto decimal.
+ * @details Esta estructura contiene un valor BCD y un indicador de punto decimal. Las funciones de escritura se deben
+ * llamar desde una sola tarea, ScreenRefresh puede ejecutarse al mismo tiempo en otra tarea o en una interrupción y
+ * muestra los cambios recién al empezar el siguiente barrido de los dígitos.
  */
 typedef struct screen_s * screen_t; //
 
+/**
+ * @brief Escrituras de puerto precalculadas para mostrar un dígito con sus segmentos.
+ * @details El significado de cada palabra lo define el controlador, por ejemplo las máscaras que se escriben en los
+ * registros de set y clear de cada puerto.
+ */
+typedef struct screen_digit_masks_s {
+    uint32_t words[SCREEN_DIGIT_WORDS];
+} screen_digit_masks_t;
+
+/**
+ * @brief Memoria para crear una pantalla con ScreenCreateStatic.
+ * @details Su contenido es privado del modulo, solo se declara para que la aplicación pueda reservarla en forma
+ * estática.
+ */
+typedef union {
+    uint8_t reserved[SCREEN_STORAGE_SIZE];
+    void * align; // Garantiza la alineación que requiere la estructura interna de la pantalla
+} screen_storage_t;
+
 /*
  * @brief Tipo de función para apagar todos los dígitos de la pantalla.
  * @details Esta función se utiliza para apagar todos los dígitos de la pantalla de 7 segmentos.
@@ -77,15 +123,37 @@ typedef void (*segments_update_t)(uint8_t);
  */
 typedef void (*digit_turn_on_t)(uint8_t);
 
+/*
+ * @brief Tipo de función para precalcular las escrituras de puerto que muestran un dígito.
+ * @details La pantalla la llama solo cuando cambia el contenido de un dígito, nunca durante el refresco.
+ * @param digit El número del dígito (0 a N-1, donde N es el número total de dígitos).
+ * @param segments Segmentos que se deben encender, incluyendo el punto.
+ * @param masks Escrituras calculadas para el dígito.
+ */
+typedef void (*digit_encode_t)(uint8_t digit, uint8_t segments, screen_digit_masks_t * masks);
+
+/*
+ * @brief Tipo de función para mostrar un dígito con escrituras precalculadas.
+ * @details Apaga el dígito anterior, actualiza los segmentos y enciende el nuevo dígito con una secuencia fija de
+ * escrituras de puerto.
+ * @param masks Escrituras calculadas por la función digit_encode_t del mismo controlador.
+ */
+typedef void (*digit_write_t)(const screen_digit_masks_t * masks);
+
 /**
  * @brief Estructura que representa un controlador de pantalla de 7 segmentos.
- * @details Esta estructura contiene punteros a funciones que permiten interactuar con la pantalla.
+ * @details Esta estructura contiene punteros a funciones que permiten interactuar con la pantalla. Si el controlador
+ * implementa DigitEncode y DigitWrite el refresco usa solo DigitWrite con las escrituras precalculadas, si no usa las
+ * otras tres funciones. Si el modulo se compila con SCREEN_INLINE_DRIVER usa en su lugar las funciones en línea de
+ * screen_driver.h, que debe proveer la placa, y el controlador indicado al crear la pantalla se ignora.
  * @note Se debe implementar en el controlador de pantalla.
  */
 typedef struct screen_driver_s {
     digits_turn_off_t DigitsTurnOff;
     segments_update_t SegmentsUpdate;
     digit_turn_on_t DigitTurnOn;
+    digit_encode_t DigitEncode;
+    digit_write_t DigitWrite;
 } const * screen_driver_t;
 
 /* === Public variable declarations ================================================================================ */
@@ -94,13 +162,24 @@ typedef struct screen_driver_s {
 
 /**
  * @brief Crea e instancia una pantalla de 7 segmentos.
+ * @details Toma la pantalla de una reserva estática de SCREEN_MAX_INSTANCES elementos, no usa memoria dinámica.
  * @param digits Número de dígitos en la pantalla.
  * @param dots Número de puntos en la pantalla.
  * @param driver Controlador de pantalla.
- * @return Un identificador para la pantalla creada.
+ * @return Un identificador para la pantalla creada, o NULL si la reserva está agotada.
  */
 screen_t ScreenCreate(uint8_t digits, uint8_t dots, screen_driver_t driver);
 
+/**
+ * @brief Crea una pantalla de 7 segmentos en la memoria indicada por la aplicación.
+ * @param storage Memoria donde se guarda la pantalla, debe existir mientras se use la pantalla.
+ * @param digits Número de dígitos en la pantalla.
+ * @param dots Número de puntos en la pantalla.
+ * @param driver Controlador de pantalla.
+ * @return Un identificador para la pantalla creada, o NULL si no se indicó la memoria.
+ */
+screen_t ScreenCreateStatic(screen_storage_t * storage, uint8_t digits, uint8_t dots, screen_driver_t driver);
+
 /**
  * @brief Escribe un valor en formato BCD en la pantalla de 7 segmentos.
  * @param screen Identificador de la pantalla.
@@ -109,6 +188,49 @@ screen_t ScreenCreate(uint8_t digits, uint8_t dots, screen_driver_t driver);
  */
 void ScreenWriteBCD(screen_t screen, uint8_t * value, uint8_t size);
 
+/**
+ * @brief Escribe un solo dígito en formato BCD, sin modificar el resto de la pantalla ni el punto del dígito.
+ * @param screen Identificador de la pantalla.
+ * @param position Posición del dígito, empezando por 0.
+ * @param value Valor del dígito, los valores mayores a 9 apagan el dígito.
+ */
+void ScreenWriteDigit(screen_t screen, uint8_t position, uint8_t value);
+
+/**
+ * @brief Escribe un texto en la pantalla, un carácter por dígito, sin modificar los puntos.
+ * @details Los caracteres ASCII se muestran con la aproximación de 7 segmentos más cercana, los que no tienen una
+ * representación razonable y los dígitos que sobran después del final del texto quedan apagados.
+ * @param screen Identificador de la pantalla.
+ * @param text Texto terminado en cero, se muestran solo los primeros caracteres que entran en la pantalla.
+ */
+void ScreenWriteText(screen_t screen, const char * text);
+
+/**
+ * @brief Devuelve los segmentos con los que se muestra un carácter ASCII.
+ * @param character Carácter a mostrar.
+ * @return Segmentos del carácter, 0 si no tiene una representación en 7 segmentos o no es ASCII.
+ */
+uint8_t ScreenGlyph(char character);
+
+/**
+ * @brief Prepara un texto para desplazarlo por la pantalla de derecha a izquierda.
+ * @details Convierte el texto a segmentos una sola vez y guarda todas las posiciones del desplazamiento en un anillo,
+ * de forma que cada paso solo avanza un índice. Muestra la primera posición, con la pantalla apagada.
+ * @param screen Identificador de la pantalla.
+ * @param text Texto terminado en cero, de hasta SCREEN_MARQUEE_LENGTH menos dos veces los dígitos de la pantalla.
+ * @return 0 si se preparó el texto, -1 si los parámetros no son válidos o el texto no entra en el anillo.
+ */
+int ScreenMarqueeStart(screen_t screen, const char * text);
+
+/**
+ * @brief Avanza un lugar el texto preparado con ScreenMarqueeStart.
+ * @details Después de la última posición vuelve a empezar, con la pantalla apagada. Sin un texto preparado no hace
+ * nada.
+ * @param screen Identificador de la pantalla.
+ * @return true si el texto terminó de pasar y vuelve a empezar.
+ */
+bool ScreenMarqueeStep(screen_t screen);
+
 /**
  * @brief Escribe un punto decimal en la pantalla de 7 segmentos.
  * @details Esta función escribe un valor en formato decimal en la pantalla de 7 segmentos, permitiendo mostrar números
@@ -126,8 +248,36 @@ void ScreenWriteDOT(screen_t screen, uint8_t * value_dot, uint8_t size);
 void ScreenRefresh(screen_t screen); //
 
 /**
- * @brief Apaga todos los dígitos de la pantalla.
+ * @brief Refresca la pantalla desde el evento de un temporizador periódico.
+ * @details Tiene la forma de las funciones de evento del temporizador del sistema, hal_tick_event_t, para poder
+ * instalarla directamente. Cada evento enciende el dígito siguiente, por lo que el período del temporizador es el
+ * tiempo que queda encendido cada dígito.
+ * @param screen Identificador de la pantalla, como puntero a los datos del evento.
+ */
+void ScreenRefreshEvent(void * screen);
+
+/**
+ * @brief Configura un grupo de parpadeo.
+ * @details Todos los grupos comparten un contador de barridos, cada grupo apaga sus dígitos y puntos durante 2^shift
+ * barridos de cada 2^(shift + 1). Un dígito apagado por el parpadeo apaga también su punto. Se puede llamar mientras
+ * se refresca la pantalla, el cambio se aplica desde el siguiente barrido.
+ * @param screen Identificador de la pantalla.
+ * @param group Grupo de parpadeo, entre 0 y SCREEN_BLINK_GROUPS - 1.
+ * @param digits Máscara de dígitos que parpadean, el bit 0 corresponde al primer dígito. Con 0 no parpadea ninguno.
+ * @param dots Máscara de puntos que parpadean, el bit 0 corresponde al punto del primer dígito.
+ * @param shift Exponente del tiempo de parpadeo, entre 0 y SCREEN_BLINK_MAX_SHIFT.
+ * @return 0 si se configuró el grupo, -1 si los parámetros no son válidos.
+ */
+int ScreenSetBlink(screen_t screen, uint8_t group, uint8_t digits, uint8_t dots, uint8_t shift);
+
+/**
+ * @brief Hace parpadear un rango de dígitos con el grupo de parpadeo 0.
  * @param screen Identificador de la pantalla.
+ * @param from Primer dígito que parpadea.
+ * @param to Último dígito que parpadea.
+ * @param divisor Barridos que los dígitos pasan apagados, se redondea hacia abajo a una potencia de 2. Con 0 se detiene
+ * el parpadeo.
+ * @return 0 si se configuró el parpadeo, -1 si los parámetros no son válidos.
  */
 int DisplayFlashDigits(screen_t screen, uint8_t from, uint8_t to, uint16_t divisor);
 
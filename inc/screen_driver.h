@@ -0,0 +1,94 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SCREEN_DRIVER_H_
+#define SCREEN_DRIVER_H_
+
+/** @file screen_driver.h
+ ** @brief Controlador de la pantalla del poncho con funciones en línea.
+ ** @details Lo usa la placa a través de screen_driver_t y, si se compila con SCREEN_INLINE_DRIVER, el modulo de
+ ** pantalla lo llama directamente para que el refresco quede como una secuencia de escrituras de registro sin llamadas
+ ** indirectas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "screen.h"
+#include "poncho.h"
+#include "digital_port.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+// Palabras que precalcula el controlador de la pantalla para cada dígito
+#define DIGIT_SEGMENTS_SET   0 // Segmentos que se encienden, en el puerto de los segmentos
+#define DIGIT_SEGMENTS_CLEAR 1 // Segmentos que se apagan, en el puerto de los segmentos
+#define DIGIT_DOT            2 // Estado del punto, que está en otro puerto
+#define DIGIT_ENABLE         3 // Bit que enciende el dígito, en el puerto de los dígitos
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Precalcula las escrituras de puerto que muestran un dígito, con la forma de digit_encode_t.
+ */
+static inline void ScreenDriverDigitEncode(uint8_t digit, uint8_t segments, screen_digit_masks_t * masks) {
+    masks->words[DIGIT_SEGMENTS_SET] = segments & SEGMENTS_MASK;
+    masks->words[DIGIT_SEGMENTS_CLEAR] = ~segments & SEGMENTS_MASK;
+    masks->words[DIGIT_DOT] = (segments & SEGMENT_P) != 0;
+    masks->words[DIGIT_ENABLE] = (1 << (3 - digit)) & DIGITS_MASK;
+}
+
+/**
+ * @brief Muestra un dígito con las escrituras precalculadas, con la forma de digit_write_t.
+ */
+static inline void ScreenDriverDigitWrite(const screen_digit_masks_t * masks) {
+#ifdef POSIX
+    // Las mismas cinco escrituras, sobre los terminales emulados que asigna el mapa de la placa
+    DigitalPortClear(DIGITS_GPIO, DIGITS_MASK);
+    DigitalPortSet(SEGMENTS_GPIO, masks->words[DIGIT_SEGMENTS_SET]);
+    DigitalPortClear(SEGMENTS_GPIO, masks->words[DIGIT_SEGMENTS_CLEAR]);
+    DigitalPinWrite(SEGMENT_P_GPIO, SEGMENT_P_BIT, masks->words[DIGIT_DOT]);
+    DigitalPortSet(DIGITS_GPIO, masks->words[DIGIT_ENABLE]);
+#else
+    // Cinco escrituras de registro, sin leer los puertos, entre el apagado del dígito anterior y el encendido del nuevo
+    LPC_GPIO_PORT->CLR[DIGITS_GPIO] = DIGITS_MASK;
+    LPC_GPIO_PORT->SET[SEGMENTS_GPIO] = masks->words[DIGIT_SEGMENTS_SET];
+    LPC_GPIO_PORT->CLR[SEGMENTS_GPIO] = masks->words[DIGIT_SEGMENTS_CLEAR];
+    LPC_GPIO_PORT->B[SEGMENT_P_GPIO][SEGMENT_P_BIT] = masks->words[DIGIT_DOT];
+    LPC_GPIO_PORT->SET[DIGITS_GPIO] = masks->words[DIGIT_ENABLE];
+#endif
+}
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCREEN_DRIVER_H_ */
@@ -0,0 +1,161 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SERIAL_SCREEN_H_
+#define SERIAL_SCREEN_H_
+
+/** @file serial_screen.h
+ ** @brief Pantallas de 7 segmentos encadenadas por una interfaz serie.
+ ** @details Maneja cadenas de registros de desplazamiento tipo 74HC595, con un registro por dígito, o de controladores
+ ** tipo MAX7219, con ocho dígitos multiplexados por cada controlador. La cadena no se multiplexa desde el
+ ** microcontrolador, cada actualización arma en un buffer las tramas con los dígitos que cambiaron desde la anterior
+ ** y las entrega al transporte en una sola llamada.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef SERIAL_SCREEN_MAX_DIGITS
+#define SERIAL_SCREEN_MAX_DIGITS 64 // Cantidad máxima de dígitos de una cadena
+#endif
+
+#ifndef SERIAL_SCREEN_MAX_INSTANCES
+#define SERIAL_SCREEN_MAX_INSTANCES 1 // Cadenas que puede entregar SerialScreenCreate sin memoria del usuario
+#endif
+
+#define SERIAL_SCREEN_DEVICE_DIGITS 8 // Dígitos que maneja cada controlador de una cadena tipo MAX7219
+
+// Controladores que necesita una cadena tipo MAX7219 con la cantidad de dígitos indicada
+#define SERIAL_SCREEN_DEVICES(digits) (((digits) + SERIAL_SCREEN_DEVICE_DIGITS - 1) / SERIAL_SCREEN_DEVICE_DIGITS)
+
+// Bytes del buffer de transmisión, en el peor caso se envía una trama de dos bytes por controlador y dígito
+#define SERIAL_SCREEN_BUFFER_SIZE (2 * SERIAL_SCREEN_DEVICE_DIGITS * SERIAL_SCREEN_DEVICES(SERIAL_SCREEN_MAX_DIGITS))
+
+// Bytes que ocupa una cadena, el modulo verifica al compilar que alcancen para su estructura interna
+#define SERIAL_SCREEN_STORAGE_SIZE (sizeof(void *) + 4 + 2 * SERIAL_SCREEN_MAX_DIGITS + SERIAL_SCREEN_BUFFER_SIZE)
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Referencia a una cadena de pantallas. Se debe usar desde una sola tarea.
+ */
+typedef struct serial_screen_s * serial_screen_t;
+
+/**
+ * @brief Tipos de cadena que maneja el modulo.
+ */
+typedef enum serial_screen_type_e {
+    SERIAL_SCREEN_SHIFT_REGISTER, // Un registro de 8 bits por dígito, la cadena se envía completa en cada cambio
+    SERIAL_SCREEN_MAX7219,        // Controladores con un registro por dígito, se envían solo los dígitos que cambian
+} serial_screen_type_t;
+
+/**
+ * @brief Función que envía un bloque de tramas por la interfaz serie.
+ * @details Envía los bytes en orden, el bit más significativo primero, y genera el pulso de carga de la cadena al
+ * final de cada trama de frame_size bytes.
+ * @param object Datos del transporte indicados en serial_transport_s.
+ * @param data Bytes a enviar.
+ * @param size Cantidad de bytes a enviar, siempre es un múltiplo de frame_size.
+ * @param frame_size Cantidad de bytes de cada trama.
+ */
+typedef void (*serial_send_t)(void * object, const uint8_t * data, uint16_t size, uint16_t frame_size);
+
+/**
+ * @brief Transporte serie de una cadena, puede ser un periférico SPI o una implementación por software.
+ */
+typedef struct serial_transport_s {
+    serial_send_t Send;
+    void * object;
+} const * serial_transport_t;
+
+/**
+ * @brief Memoria para crear una cadena con SerialScreenCreateStatic.
+ * @details Su contenido es privado del modulo, solo se declara para que la aplicación pueda reservarla en forma
+ * estática.
+ */
+typedef union {
+    uint8_t reserved[SERIAL_SCREEN_STORAGE_SIZE];
+    void * align; // Garantiza la alineación que requiere la estructura interna de la cadena
+} serial_screen_storage_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una cadena de pantallas tomándola de una reserva estática de SERIAL_SCREEN_MAX_INSTANCES elementos.
+ * @details En las cadenas tipo MAX7219 envía la configuración de los controladores, sin decodificación y con todos
+ * los dígitos habilitados.
+ * @param type Tipo de cadena.
+ * @param digits Cantidad de dígitos, entre 1 y SERIAL_SCREEN_MAX_DIGITS.
+ * @param transport Transporte serie de la cadena.
+ * @return Referencia a la cadena, o NULL si los parámetros no son válidos o la reserva está agotada.
+ */
+serial_screen_t SerialScreenCreate(serial_screen_type_t type, uint8_t digits, serial_transport_t transport);
+
+/**
+ * @brief Crea una cadena de pantallas en la memoria indicada por la aplicación.
+ * @param storage Memoria donde se guarda la cadena, debe existir mientras se use la cadena.
+ * @param type Tipo de cadena.
+ * @param digits Cantidad de dígitos, entre 1 y SERIAL_SCREEN_MAX_DIGITS.
+ * @param transport Transporte serie de la cadena.
+ * @return Referencia a la cadena, o NULL si los parámetros no son válidos.
+ */
+serial_screen_t SerialScreenCreateStatic(serial_screen_storage_t * storage, serial_screen_type_t type, uint8_t digits,
+                                         serial_transport_t transport);
+
+/**
+ * @brief Escribe los segmentos de varios dígitos consecutivos, se envían en la próxima actualización.
+ * @param screen Referencia a la cadena.
+ * @param position Primer dígito a escribir, empezando por 0.
+ * @param segments Segmentos de cada dígito, con los bits SEGMENT_A a SEGMENT_P de screen.h.
+ * @param count Cantidad de dígitos a escribir, los que quedan fuera de la cadena se descartan.
+ */
+void SerialScreenWriteSegments(serial_screen_t screen, uint8_t position, const uint8_t * segments, uint8_t count);
+
+/**
+ * @brief Escribe un texto desde el primer dígito, con un carácter por dígito. Los dígitos que sobran se apagan.
+ * @param screen Referencia a la cadena.
+ * @param text Texto terminado en cero.
+ */
+void SerialScreenWriteText(serial_screen_t screen, const char * text);
+
+/**
+ * @brief Envía a la cadena los dígitos que cambiaron desde la actualización anterior, en una sola llamada al
+ * transporte.
+ * @param screen Referencia a la cadena.
+ * @return Cantidad de bytes enviados, 0 si no había cambios.
+ */
+uint16_t SerialScreenUpdate(serial_screen_t screen);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SERIAL_SCREEN_H_ */
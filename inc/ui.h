@@ -0,0 +1,131 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file ui.h
+ ** @brief Interfaz de usuario del reloj despertador, como una máquina de estados manejada por eventos.
+ ** @details Cada evento se busca en una tabla constante de transiciones, indexada por el modo actual y el evento, que
+ ** indica la acción a ejecutar y el modo siguiente. El módulo no usa el sistema operativo: la aplicación le entrega los
+ ** eventos de las teclas, del reloj y del vencimiento de la edición, de a uno por vez.
+ **/
+
+#ifndef UI_H_
+#define UI_H_
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "bsp.h"
+#include "clock.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef UI_MAX_INSTANCES
+#define UI_MAX_INSTANCES 1 // Cantidad de interfaces que puede entregar UiCreate sin memoria del usuario
+#endif
+
+#define UI_STORAGE_SIZE 32 // Bytes que ocupa una interfaz, el módulo verifica al compilar que alcancen
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Eventos que recibe la interfaz. Los eventos de las teclas van primero, hasta UI_EVENT_CANCEL.
+ */
+typedef enum {
+    UI_EVENT_NONE = 0,  // Ningún evento, no produce cambios
+    UI_EVENT_SET_TIME,  // Presión larga de la tecla que ajusta la hora
+    UI_EVENT_SET_ALARM, // Presión larga de la tecla que ajusta la alarma
+    UI_EVENT_INCREMENT, // Presión corta o repetición de la tecla de incrementar
+    UI_EVENT_DECREMENT, // Presión corta o repetición de la tecla de decrementar
+    UI_EVENT_ACCEPT,    // Presión corta de la tecla de aceptar
+    UI_EVENT_CANCEL,    // Presión corta de la tecla de cancelar
+    UI_EVENT_MINUTE,    // El reloj cambió de minuto
+    UI_EVENT_ALARM,     // Venció la alarma o la alarma pospuesta
+    UI_EVENT_TIMEOUT,   // Pasó el tiempo máximo de edición sin que se presione una tecla
+    UI_EVENT_COUNT,     // Cantidad de eventos, no es un evento
+} ui_event_t;
+
+/**
+ * @brief Referencia a una interfaz de usuario.
+ */
+typedef struct ui_s * ui_t;
+
+/**
+ * @brief Memoria para crear una interfaz con UiCreateStatic.
+ *
+ * Su contenido es privado del modulo, solo se declara para que la aplicación pueda reservarla en forma estática.
+ */
+typedef union {
+    uint8_t reserved[UI_STORAGE_SIZE];
+    void * align; // Garantiza la alineación que requiere la estructura interna
+} ui_storage_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea la interfaz de usuario, tomándola de una reserva estática de UI_MAX_INSTANCES elementos.
+ * @details La interfaz arranca en MODE_UNSET, con la pantalla parpadeando hasta que se ajuste la hora.
+ * @param board Placa con la pantalla y los indicadores que maneja la interfaz.
+ * @param clock Reloj que se consulta y se ajusta.
+ * @return Un puntero a la interfaz, o NULL si la reserva está agotada.
+ */
+ui_t UiCreate(Board_t board, clock_t clock);
+
+/**
+ * @brief Crea la interfaz de usuario en la memoria indicada por la aplicación.
+ * @param storage Memoria donde se guarda la interfaz, debe existir mientras se use.
+ * @param board Placa con la pantalla y los indicadores que maneja la interfaz.
+ * @param clock Reloj que se consulta y se ajusta.
+ * @return Un puntero a la interfaz, o NULL si los parámetros no son válidos.
+ */
+ui_t UiCreateStatic(ui_storage_t * storage, Board_t board, clock_t clock);
+
+/**
+ * @brief Procesa un evento con la tabla de transiciones y actualiza la pantalla.
+ * @details Los eventos que la tabla no prevé para el modo actual se descartan sin cambios.
+ * @param ui Interfaz que recibe el evento.
+ * @param event Evento a procesar.
+ */
+void UiHandleEvent(ui_t ui, ui_event_t event);
+
+/**
+ * @brief Devuelve el modo actual de la interfaz.
+ */
+system_mode_t UiGetMode(ui_t ui);
+
+/**
+ * @brief Indica si la interfaz está en un modo de edición, donde se espera UI_EVENT_TIMEOUT si no se usan las teclas.
+ */
+bool UiIsEditing(ui_t ui);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_H_ */
@@ -0,0 +1,128 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef VIRTUAL_SCREEN_H_
+#define VIRTUAL_SCREEN_H_
+
+/** @file virtual_screen.h
+ ** @brief Pantalla de 7 segmentos virtual que registra los dígitos que enciende el refresco.
+ ** @details Implementa un controlador de pantalla sin hardware, para la placa POSIX y las pruebas en el host. Guarda
+ ** cada encendido de un dígito con su duración en un anillo, calcula a partir de ellos la frecuencia de refresco, el
+ ** tiempo encendido de cada dígito, la variación entre encendidos y los efectos fantasma, y puede dibujar la pantalla
+ ** como texto. Hay una sola pantalla virtual, igual que el controlador de la placa.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "screen.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef VIRTUAL_SCREEN_RECORDS
+#define VIRTUAL_SCREEN_RECORDS 64 // Encendidos de dígitos que guarda el anillo de registros
+#endif
+
+// Bytes que necesita VirtualScreenRender para dibujar una pantalla con la cantidad de dígitos indicada
+#define VIRTUAL_SCREEN_RENDER_SIZE(digits) (3U * (4U * (digits) + 1U) + 1U)
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Función que devuelve el tiempo actual en microsegundos, usada para marcar cada registro.
+ */
+typedef uint32_t (*virtual_screen_clock_t)(void);
+
+/**
+ * @brief Registro del encendido de un dígito.
+ */
+typedef struct virtual_screen_record_s {
+    uint32_t start;    // Momento en que se encendió el dígito, en microsegundos
+    uint32_t duration; // Tiempo que estuvo encendido, en microsegundos
+    uint8_t digit;     // Dígito encendido
+    uint8_t segments;  // Segmentos que tenía al encenderse
+} virtual_screen_record_t;
+
+/**
+ * @brief Mediciones calculadas a partir de los registros guardados en el anillo.
+ */
+typedef struct virtual_screen_stats_s {
+    uint32_t scans;                      // Barridos completos, contados por los encendidos del primer dígito
+    uint32_t scan_period;                // Duración media de un barrido, en microsegundos
+    uint32_t refresh_rate;               // Barridos por segundo
+    uint32_t on_time[SCREEN_MAX_DIGITS]; // Tiempo medio que queda encendido cada dígito, en microsegundos
+    uint32_t slot_min;                   // Menor tiempo entre dos encendidos consecutivos, en microsegundos
+    uint32_t slot_max;                   // Mayor tiempo entre dos encendidos consecutivos, en microsegundos
+    uint32_t jitter;                     // Diferencia entre el mayor y el menor tiempo entre encendidos
+    uint32_t ghosts;                     // Veces que un dígito mostró segmentos ajenos
+} virtual_screen_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Inicializa la pantalla virtual y devuelve su controlador para crear la pantalla con ScreenCreate.
+ * @details Implementa las funciones de apagado, segmentos y encendido de screen_driver_t, sin las escrituras
+ * precalculadas, para que se puedan observar los efectos fantasma entre los pasos del refresco. Vuelve a empezar los
+ * registros si se llama de nuevo.
+ * @param digits Número de dígitos de la pantalla.
+ * @param clock Función que devuelve el tiempo actual en microsegundos.
+ * @param render_rate Cantidad máxima de veces por segundo que VirtualScreenRender dibuja la pantalla, con 0 no dibuja.
+ * @return Controlador de la pantalla virtual, o NULL si los parámetros no son válidos.
+ */
+screen_driver_t VirtualScreenCreate(uint8_t digits, virtual_screen_clock_t clock, uint16_t render_rate);
+
+/**
+ * @brief Copia los registros guardados, del más antiguo al más reciente.
+ * @param records Vector donde se copian los registros.
+ * @param count Cantidad máxima de registros a copiar, si hay más se copian los más recientes.
+ * @return Cantidad de registros copiados.
+ */
+uint16_t VirtualScreenRecords(virtual_screen_record_t * records, uint16_t count);
+
+/**
+ * @brief Calcula las mediciones de la pantalla con los registros guardados.
+ * @param stats Estructura donde se devuelven las mediciones.
+ */
+void VirtualScreenGetStats(virtual_screen_stats_t * stats);
+
+/**
+ * @brief Dibuja la pantalla como texto, con tres líneas de caracteres por dígito y su punto.
+ * @details Cada dígito se dibuja con los últimos segmentos con los que estuvo encendido, como los vería una persona.
+ * Limita la cantidad de dibujos por segundo a la indicada al crear la pantalla, para poder llamarla en cada refresco.
+ * @param text Texto donde se dibuja la pantalla, terminado en cero.
+ * @param size Tamaño del texto, debe ser al menos VIRTUAL_SCREEN_RENDER_SIZE de la cantidad de dígitos.
+ * @return true si se dibujó la pantalla, false si todavía no pasó el tiempo mínimo entre dibujos o no hay lugar.
+ */
+bool VirtualScreenRender(char * text, size_t size);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VIRTUAL_SCREEN_H_ */
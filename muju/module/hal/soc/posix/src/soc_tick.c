@@ -35,12 +35,15 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 
 #include "soc_tick.h"
+#include <errno.h>
 #include <pthread.h>
-#include <unistd.h>
+#include <time.h>
 #include <stdio.h>
 
 /* === Macros definitions ====================================================================== */
 
+#define NANOSECONDS_PER_SECOND 1000000000L
+
 /* === Private data type declarations ========================================================== */
 
 /**
@@ -77,8 +80,19 @@ static struct hal_tick_s instance[1] = {0};
 /* === Private function implementation ========================================================= */
 
 static void * TimerThread(void * _) {
+    struct timespec deadline;
+
+    /* Events are scheduled on absolute deadlines so the handler run time does not accumulate as drift */
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
     while (true) {
-        usleep(instance->period);
+        deadline.tv_nsec += (long)(instance->period % 1000000) * 1000;
+        deadline.tv_sec += instance->period / 1000000;
+        if (deadline.tv_nsec >= NANOSECONDS_PER_SECOND) {
+            deadline.tv_nsec -= NANOSECONDS_PER_SECOND;
+            deadline.tv_sec++;
+        }
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+        }
         if (instance->handler) {
             instance->handler(instance->object);
         }
@@ -18,165 +18,137 @@ SPDX-License-Identifier: MIT
 *********************************************************************************************************************/
 
 /** @file bsp.c
- ** @brief
+ ** @brief Pantalla, entradas y salidas del poncho, comunes a todas las placas.
+ ** @details Los terminales se manejan con digital_port.h usando los pares puerto y bit de poncho.h. El bsp de cada
+ ** placa conecta los terminales con BoardPinsInit y provee el temporizador de la pantalla y los eventos de las teclas.
  **/
 
 /* === Headers files inclusions ==================================================================================== */
 
-#include <stdlib.h>
 #include "bsp.h"
+#include "bsp_pins.h"
 #include "config.h"
 #include "digital.h"
+#include "digital_port.h"
 #include <stdbool.h>
-#include "chip.h"
 #include <stddef.h>
 #include "poncho.h"
+#include "screen_driver.h"
 
 /* === Macros definitions ========================================================================================== */
 
 /* === Private data type declarations ============================================================================== */
 
 /* === Private function declarations =============================================================================== */
+
 static void DigitsTurnOff(void);
 
 static void SegmentsUpdate(uint8_t value);
 
 static void DigitTurnOn(uint8_t digit);
 
-static void SegmentsInit(void);
+static void DigitEncode(uint8_t digit, uint8_t segments, screen_digit_masks_t * masks);
+
+static void DigitWrite(const screen_digit_masks_t * masks);
+
+static void DisplayInit(void);
 
-static void DigitsInit(void);
 /* === Private variable definitions ================================================================================ */
 
-static const struct screen_driver_s display_driver = {
-    .DigitsTurnOff = DigitsTurnOff, .SegmentsUpdate = SegmentsUpdate, .DigitTurnOn = DigitTurnOn};
+static const struct screen_driver_s display_driver = {.DigitsTurnOff = DigitsTurnOff,
+                                                       .SegmentsUpdate = SegmentsUpdate,
+                                                       .DigitTurnOn = DigitTurnOn,
+                                                       .DigitEncode = DigitEncode,
+                                                       .DigitWrite = DigitWrite};
+
+static struct Board_s board; // La placa es unica, sus objetos se toman de las reservas estaticas de cada modulo
+
+// Terminales de los dígitos y los segmentos, se configuran como salidas apagadas
+static const struct {
+    uint8_t gpio;
+    uint8_t bit;
+} display_pins[] = {
+    {DIGIT_1_GPIO, DIGIT_1_BIT},     {DIGIT_2_GPIO, DIGIT_2_BIT},     {DIGIT_3_GPIO, DIGIT_3_BIT},
+    {DIGIT_4_GPIO, DIGIT_4_BIT},     {SEGMENT_A_GPIO, SEGMENT_A_BIT}, {SEGMENT_B_GPIO, SEGMENT_B_BIT},
+    {SEGMENT_C_GPIO, SEGMENT_C_BIT}, {SEGMENT_D_GPIO, SEGMENT_D_BIT}, {SEGMENT_E_GPIO, SEGMENT_E_BIT},
+    {SEGMENT_F_GPIO, SEGMENT_F_BIT}, {SEGMENT_G_GPIO, SEGMENT_G_BIT}, {SEGMENT_P_GPIO, SEGMENT_P_BIT},
+};
 
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
 static void DigitsTurnOff(void) {
-    Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
-    Chip_GPIO_ClearValue(LPC_GPIO_PORT, SEGMENTS_GPIO, SEGMENTS_MASK);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
+    DigitalPortClear(DIGITS_GPIO, DIGITS_MASK);
+    DigitalPortClear(SEGMENTS_GPIO, SEGMENTS_MASK);
+    DigitalPinWrite(SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
 }
 
 static void SegmentsUpdate(uint8_t value) {
-    Chip_GPIO_SetValue(LPC_GPIO_PORT, SEGMENTS_GPIO, value & SEGMENTS_MASK);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, (value & SEGMENT_P));
+    DigitalPortSet(SEGMENTS_GPIO, value & SEGMENTS_MASK);
+    DigitalPinWrite(SEGMENT_P_GPIO, SEGMENT_P_BIT, (value & SEGMENT_P));
 }
 
 static void DigitTurnOn(uint8_t digit) {
-    Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, (1 << (3 - digit)) & DIGITS_MASK);
+    DigitalPortSet(DIGITS_GPIO, (1 << (3 - digit)) & DIGITS_MASK);
 }
 
-static void SegmentsInit(void) {
-    Chip_SCU_PinMuxSet(SEGMENT_A_PORT, SEGMENT_A_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_A_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, true);
-
-    Chip_SCU_PinMuxSet(SEGMENT_B_PORT, SEGMENT_B_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_B_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, true);
-
-    Chip_SCU_PinMuxSet(SEGMENT_C_PORT, SEGMENT_C_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_C_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, true);
-
-    Chip_SCU_PinMuxSet(SEGMENT_D_PORT, SEGMENT_D_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_D_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, true);
-
-    Chip_SCU_PinMuxSet(SEGMENT_E_PORT, SEGMENT_E_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_E_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, true);
-
-    Chip_SCU_PinMuxSet(SEGMENT_F_PORT, SEGMENT_F_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_F_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, true);
-
-    Chip_SCU_PinMuxSet(SEGMENT_G_PORT, SEGMENT_G_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_G_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, true);
-
-    Chip_SCU_PinMuxSet(SEGMENT_P_PORT, SEGMENT_P_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_P_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, true);
+static void DigitEncode(uint8_t digit, uint8_t segments, screen_digit_masks_t * masks) {
+    ScreenDriverDigitEncode(digit, segments, masks);
 }
 
-static void DigitsInit(void) {
-    Chip_SCU_PinMuxSet(DIGIT_1_PORT, DIGIT_1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_1_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, true);
-
-    Chip_SCU_PinMuxSet(DIGIT_2_PORT, DIGIT_2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_2_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, true);
-
-    Chip_SCU_PinMuxSet(DIGIT_3_PORT, DIGIT_3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_3_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, true);
+static void DigitWrite(const screen_digit_masks_t * masks) {
+    ScreenDriverDigitWrite(masks);
+}
 
-    Chip_SCU_PinMuxSet(DIGIT_4_PORT, DIGIT_4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_4_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, true);
+static void DisplayInit(void) {
+    for (uint8_t index = 0; index < sizeof(display_pins) / sizeof(display_pins[0]); index++) {
+        DigitalPinWrite(display_pins[index].gpio, display_pins[index].bit, false);
+        DigitalPinSetDirection(display_pins[index].gpio, display_pins[index].bit, true);
+    }
 }
 
 /* === Public function definitions ============================================================================== */
+
 Board_t BoardCreate(void) {
+    struct Board_s * self = &board;
 
-    struct Board_s * self = malloc(sizeof(struct Board_s));
-
-    if (self != NULL) {
-        DigitsInit();
-        SegmentsInit();
-        self->screen = ScreenCreate(4, 4, &display_driver);
-    }
+    BoardPinsInit();
+    DisplayInit();
+    self->screen = ScreenCreate(4, 4, BoardScreenDriver(&display_driver));
 
     // Salidas digitales
-    Chip_SCU_PinMuxSet(PONCHO_RGB_RED_PORT, PONCHO_RGB_RED_PIN,
-                       SCU_MODE_INBUFF_EN | SCU_MODE_INACT | PONCHO_RGB_RED_FUNC);
     self->led_red = DigitalOutputCreate(PONCHO_RGB_RED_GPIO, PONCHO_RGB_RED_BIT, true);
-
-    Chip_SCU_PinMuxSet(PONCHO_RGB_GREEN_PORT, PONCHO_RGB_GREEN_PIN,
-                       SCU_MODE_INBUFF_EN | SCU_MODE_INACT | PONCHO_RGB_GREEN_FUNC);
     self->led_green = DigitalOutputCreate(PONCHO_RGB_GREEN_GPIO, PONCHO_RGB_GREEN_BIT, true);
-
-    Chip_SCU_PinMuxSet(PONCHO_RGB_BLUE_PORT, PONCHO_RGB_BLUE_PIN,
-                       SCU_MODE_INBUFF_EN | SCU_MODE_INACT | PONCHO_RGB_BLUE_FUNC);
     self->led_blue = DigitalOutputCreate(PONCHO_RGB_BLUE_GPIO, PONCHO_RGB_BLUE_BIT, true);
+    self->buzzer = DigitalOutputCreate(BUZZER_GPIO, BUZZER_BIT, true);
 
-    // entradas digitales
-    Chip_SCU_PinMuxSet(KEY_F1_PORT, KEY_F1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F1_FUNC);
-    self->set_time = DigitalInputCreate(KEY_F1_GPIO, KEY_F1_BIT, true);
+    // El orden en que se agregan las salidas es el de los bits BOARD_LED_* y BOARD_BUZZER
+    self->indicators = DigitalOutputGroupCreate();
+    DigitalOutputGroupAdd(self->indicators, self->led_red);
+    DigitalOutputGroupAdd(self->indicators, self->led_green);
+    DigitalOutputGroupAdd(self->indicators, self->led_blue);
+    DigitalOutputGroupAdd(self->indicators, self->buzzer);
+    DigitalOutputGroupWrite(self->indicators, BOARD_BUZZER, 0); // La salida se crea activa, el zumbador arranca apagado
 
-    Chip_SCU_PinMuxSet(KEY_F2_PORT, KEY_F2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F2_FUNC);
+    // Entradas digitales
+    self->set_time = DigitalInputCreate(KEY_F1_GPIO, KEY_F1_BIT, true);
     self->set_alarm = DigitalInputCreate(KEY_F2_GPIO, KEY_F2_BIT, true);
-
-    Chip_SCU_PinMuxSet(KEY_F3_PORT, KEY_F3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F3_FUNC);
     self->decrement = DigitalInputCreate(KEY_F3_GPIO, KEY_F3_BIT, true);
-
-    Chip_SCU_PinMuxSet(KEY_F4_PORT, KEY_F4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_F4_FUNC);
     self->increment = DigitalInputCreate(KEY_F4_GPIO, KEY_F4_BIT, true);
-
-    Chip_SCU_PinMuxSet(KEY_ACCEPT_PORT, KEY_ACCEPT_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_ACCEPT_FUNC);
     self->accept = DigitalInputCreate(KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, true);
-
-    Chip_SCU_PinMuxSet(KEY_CANCEL_PORT, KEY_CANCEL_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_CANCEL_FUNC);
     self->cancel = DigitalInputCreate(KEY_CANCEL_GPIO, KEY_CANCEL_BIT, true);
 
-    return self;
-}
-
-void SysTickInit(uint16_t ticks) {
-    __asm volatile("cpsid i"); // Deshabilita las interrupciones
+    // Todas las teclas se muestrean juntas, con una sola lectura de cada puerto
+    self->keys = DigitalInputGroupCreate();
+    DigitalInputGroupAdd(self->keys, self->set_time);
+    DigitalInputGroupAdd(self->keys, self->set_alarm);
+    DigitalInputGroupAdd(self->keys, self->decrement);
+    DigitalInputGroupAdd(self->keys, self->increment);
+    DigitalInputGroupAdd(self->keys, self->accept);
+    DigitalInputGroupAdd(self->keys, self->cancel);
 
-    SystemCoreClockUpdate();                 // Actualiza la frecuencia del núcleo del sistema
-    SysTick_Config(SystemCoreClock / ticks); // Configura SysTick para interrupciones cada 1 ms
-
-    NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 1); // Establece la prioridad más baja para SysTick
-
-    __asm volatile("cpsie i"); // Habilita las interrupciones
+    return self;
 }
 
 /* === End of documentation ======================================================================================== */
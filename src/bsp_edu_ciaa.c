@@ -0,0 +1,221 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bsp_edu_ciaa.c
+ ** @brief Conexiones del poncho en la EDU-CIAA-NXP, temporizador de la pantalla y eventos de las teclas.
+ ** @details La pantalla, las entradas y las salidas las crea bsp.c con los mismos pares puerto y bit en todas las
+ ** placas, aca solo se conecta cada terminal del LPC4337 a su puerto gpio.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#ifndef POSIX
+
+#include "bsp.h"
+#include "bsp_pins.h"
+#include "config.h"
+#include <stdbool.h>
+#include "chip.h"
+#include <stddef.h>
+#include "poncho.h"
+
+/* === Macros definitions ========================================================================================== */
+
+// La pantalla se refresca por encima de las interrupciones que usan el sistema operativo para que el brillo no dependa
+// de la carga
+#define DISPLAY_TIMER_PRIORITY 1
+
+// Las teclas interrumpen por debajo de configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY, para avisar a las tareas
+#define KEY_EVENT_PRIORITY 6
+
+#define KEY_EVENT_CHANNELS 6 // Canales de interrupción de terminal que usan las teclas, uno por tecla
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void KeyEventsDisable(void);
+
+static void KeyEventHandle(uint8_t channel);
+
+/* === Private variable definitions ================================================================================ */
+
+static struct {
+    board_timer_event_t handler; // Función que atiende el evento del temporizador de la pantalla
+    void * object;               // Datos de usuario que recibe la función
+} display_timer;
+
+static struct {
+    board_key_event_t handler; // Función que atiende el primer flanco de las teclas
+    void * object;             // Datos de usuario que recibe la función
+} key_events;
+
+// Terminal del LPC4337 y función gpio de cada terminal del poncho
+static const struct {
+    uint8_t port;
+    uint8_t pin;
+    uint16_t func;
+} pin_mux[] = {
+    {DIGIT_1_PORT, DIGIT_1_PIN, DIGIT_1_FUNC},
+    {DIGIT_2_PORT, DIGIT_2_PIN, DIGIT_2_FUNC},
+    {DIGIT_3_PORT, DIGIT_3_PIN, DIGIT_3_FUNC},
+    {DIGIT_4_PORT, DIGIT_4_PIN, DIGIT_4_FUNC},
+
+    {SEGMENT_A_PORT, SEGMENT_A_PIN, SEGMENT_A_FUNC},
+    {SEGMENT_B_PORT, SEGMENT_B_PIN, SEGMENT_B_FUNC},
+    {SEGMENT_C_PORT, SEGMENT_C_PIN, SEGMENT_C_FUNC},
+    {SEGMENT_D_PORT, SEGMENT_D_PIN, SEGMENT_D_FUNC},
+    {SEGMENT_E_PORT, SEGMENT_E_PIN, SEGMENT_E_FUNC},
+    {SEGMENT_F_PORT, SEGMENT_F_PIN, SEGMENT_F_FUNC},
+    {SEGMENT_G_PORT, SEGMENT_G_PIN, SEGMENT_G_FUNC},
+    {SEGMENT_P_PORT, SEGMENT_P_PIN, SEGMENT_P_FUNC},
+
+    {PONCHO_RGB_RED_PORT, PONCHO_RGB_RED_PIN, PONCHO_RGB_RED_FUNC},
+    {PONCHO_RGB_GREEN_PORT, PONCHO_RGB_GREEN_PIN, PONCHO_RGB_GREEN_FUNC},
+    {PONCHO_RGB_BLUE_PORT, PONCHO_RGB_BLUE_PIN, PONCHO_RGB_BLUE_FUNC},
+    {BUZZER_PORT, BUZZER_PIN, BUZZER_FUNC},
+
+    {KEY_F1_PORT, KEY_F1_PIN, KEY_F1_FUNC},
+    {KEY_F2_PORT, KEY_F2_PIN, KEY_F2_FUNC},
+    {KEY_F3_PORT, KEY_F3_PIN, KEY_F3_FUNC},
+    {KEY_F4_PORT, KEY_F4_PIN, KEY_F4_FUNC},
+    {KEY_ACCEPT_PORT, KEY_ACCEPT_PIN, KEY_ACCEPT_FUNC},
+    {KEY_CANCEL_PORT, KEY_CANCEL_PIN, KEY_CANCEL_FUNC},
+};
+
+// Terminal de cada tecla, en el orden de los canales de interrupción que ocupan
+static const struct {
+    uint8_t gpio;
+    uint8_t bit;
+} key_pins[KEY_EVENT_CHANNELS] = {
+    {KEY_F1_GPIO, KEY_F1_BIT}, {KEY_F2_GPIO, KEY_F2_BIT},         {KEY_F3_GPIO, KEY_F3_BIT},
+    {KEY_F4_GPIO, KEY_F4_BIT}, {KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT}, {KEY_CANCEL_GPIO, KEY_CANCEL_BIT},
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ============================================================================== */
+
+void BoardPinsInit(void) {
+    for (uint8_t index = 0; index < sizeof(pin_mux) / sizeof(pin_mux[0]); index++) {
+        Chip_SCU_PinMuxSet(pin_mux[index].port, pin_mux[index].pin,
+                           SCU_MODE_INBUFF_EN | SCU_MODE_INACT | pin_mux[index].func);
+    }
+}
+
+screen_driver_t BoardScreenDriver(screen_driver_t driver) {
+    return driver; // La pantalla es la del poncho
+}
+
+void DisplayTimerStart(board_timer_event_t handler, void * object, uint32_t period) {
+    display_timer.handler = handler;
+    display_timer.object = object;
+
+    Chip_RIT_Init(LPC_RITIMER);
+    Chip_RIT_SetCOMPVAL(LPC_RITIMER, (Chip_Clock_GetRate(CLK_MX_RITIMER) / 1000000) * period);
+    Chip_RIT_EnableCTRL(LPC_RITIMER, RIT_CTRL_ENCLR); // El contador vuelve a cero en cada evento
+    NVIC_SetPriority(RITIMER_IRQn, DISPLAY_TIMER_PRIORITY);
+    NVIC_EnableIRQ(RITIMER_IRQn);
+    Chip_RIT_Enable(LPC_RITIMER);
+}
+
+void RIT_IRQHandler(void) {
+    Chip_RIT_ClearInt(LPC_RITIMER);
+    if (display_timer.handler) {
+        display_timer.handler(display_timer.object);
+    }
+}
+
+static void KeyEventsDisable(void) {
+    for (uint8_t channel = 0; channel < KEY_EVENT_CHANNELS; channel++) {
+        NVIC_DisableIRQ(PIN_INT0_IRQn + channel);
+    }
+}
+
+static void KeyEventHandle(uint8_t channel) {
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(channel));
+    KeyEventsDisable(); // Los rebotes los filtra la tarea que muestrea las teclas
+    if (key_events.handler) {
+        key_events.handler(key_events.object);
+    }
+}
+
+void KeyEventsStart(board_key_event_t handler, void * object) {
+    key_events.handler = handler;
+    key_events.object = object;
+
+    KeyEventsDisable();
+    for (uint8_t channel = 0; channel < KEY_EVENT_CHANNELS; channel++) {
+        Chip_SCU_GPIOIntPinSel(channel, key_pins[channel].gpio, key_pins[channel].bit);
+        Chip_PININT_SetPinModeEdge(LPC_GPIO_PIN_INT, PININTCH(channel));
+        Chip_PININT_EnableIntHigh(LPC_GPIO_PIN_INT, PININTCH(channel));
+        Chip_PININT_EnableIntLow(LPC_GPIO_PIN_INT, PININTCH(channel));
+        NVIC_SetPriority(PIN_INT0_IRQn + channel, KEY_EVENT_PRIORITY);
+    }
+}
+
+bool KeyEventsEnable(void) {
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, (1 << KEY_EVENT_CHANNELS) - 1);
+    for (uint8_t channel = 0; channel < KEY_EVENT_CHANNELS; channel++) {
+        NVIC_ClearPendingIRQ(PIN_INT0_IRQn + channel);
+        NVIC_EnableIRQ(PIN_INT0_IRQn + channel);
+    }
+    return true;
+}
+
+void GPIO0_IRQHandler(void) {
+    KeyEventHandle(0);
+}
+
+void GPIO1_IRQHandler(void) {
+    KeyEventHandle(1);
+}
+
+void GPIO2_IRQHandler(void) {
+    KeyEventHandle(2);
+}
+
+void GPIO3_IRQHandler(void) {
+    KeyEventHandle(3);
+}
+
+void GPIO4_IRQHandler(void) {
+    KeyEventHandle(4);
+}
+
+void GPIO5_IRQHandler(void) {
+    KeyEventHandle(5);
+}
+
+void SysTickInit(uint16_t ticks) {
+    __asm volatile("cpsid i"); // Deshabilita las interrupciones
+
+    SystemCoreClockUpdate();                 // Actualiza la frecuencia del núcleo del sistema
+    SysTick_Config(SystemCoreClock / ticks); // Configura SysTick para interrupciones cada 1 ms
+
+    NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 1); // Establece la prioridad más baja para SysTick
+
+    __asm volatile("cpsie i"); // Habilita las interrupciones
+}
+
+#endif
+
+/* === End of documentation ======================================================================================== */
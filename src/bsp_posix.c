@@ -0,0 +1,188 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bsp_posix.c
+ ** @brief Placa emulada con los terminales de hal_gpio, para ejecutar la aplicación en la computadora.
+ ** @details Se compila con BOARD=posix. Las entradas, las salidas y la pantalla que crea bsp.c usan los mismos pares
+ ** puerto y bit de poncho.h, que el mapa de terminales traduce a los terminales emulados. Las teclas 1 a 6 del teclado
+ ** cambian el estado de las teclas del poncho y la consola muestra el estado de los leds y el zumbador. La pantalla es
+ ** la pantalla virtual, que se dibuja debajo del estado de los terminales junto con sus mediciones del refresco.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#ifdef POSIX
+
+#include "bsp.h"
+#include "bsp_pins.h"
+#include "config.h"
+#include "digital_port.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <time.h>
+#include "hal_gpio.h"
+#include "soc_gpio.h"
+#include "FreeRTOS.h"
+#include "timers.h"
+#include "poncho.h"
+#include "virtual_screen.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define DISPLAY_DIGITS      4  // Dígitos de la pantalla del poncho
+#define DISPLAY_RENDER_RATE 20 // Veces por segundo que se dibuja la pantalla virtual en la consola
+#define DISPLAY_RENDER_ROW  6  // Línea de la consola donde se dibuja, debajo de los cuatro puertos de hal_gpio
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Devuelve el tiempo del sistema en microsegundos, para marcar los registros de la pantalla virtual.
+ */
+static uint32_t DisplayClock(void);
+
+static void DisplayTimerEvent(TimerHandle_t timer);
+
+/* === Private variable definitions ================================================================================ */
+
+static struct {
+    board_timer_event_t handler; // Función que atiende el evento del temporizador de la pantalla
+    void * object;               // Datos de usuario que recibe la función
+} display_timer;
+
+// Terminal emulado de cada terminal del poncho. Las teclas quedan en GPIO0 porque son las que cambia el teclado, y
+// hal_gpio deja las entradas emuladas en alto como si tuvieran resistencia de pull-up
+static const struct {
+    uint8_t gpio;
+    uint8_t bit;
+    const hal_gpio_bit_t * pin;
+} pin_map[] = {
+    {KEY_F1_GPIO, KEY_F1_BIT, &HAL_GPIO0_0},
+    {KEY_F2_GPIO, KEY_F2_BIT, &HAL_GPIO0_1},
+    {KEY_F3_GPIO, KEY_F3_BIT, &HAL_GPIO0_2},
+    {KEY_F4_GPIO, KEY_F4_BIT, &HAL_GPIO0_3},
+    {KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, &HAL_GPIO0_4},
+    {KEY_CANCEL_GPIO, KEY_CANCEL_BIT, &HAL_GPIO0_5},
+
+    {PONCHO_RGB_RED_GPIO, PONCHO_RGB_RED_BIT, &HAL_GPIO1_0},
+    {PONCHO_RGB_GREEN_GPIO, PONCHO_RGB_GREEN_BIT, &HAL_GPIO1_1},
+    {PONCHO_RGB_BLUE_GPIO, PONCHO_RGB_BLUE_BIT, &HAL_GPIO1_2},
+    {BUZZER_GPIO, BUZZER_BIT, &HAL_GPIO1_3},
+    {DIGIT_1_GPIO, DIGIT_1_BIT, &HAL_GPIO1_4},
+    {DIGIT_2_GPIO, DIGIT_2_BIT, &HAL_GPIO1_5},
+    {DIGIT_3_GPIO, DIGIT_3_BIT, &HAL_GPIO1_6},
+    {DIGIT_4_GPIO, DIGIT_4_BIT, &HAL_GPIO1_7},
+
+    {SEGMENT_A_GPIO, SEGMENT_A_BIT, &HAL_GPIO2_0},
+    {SEGMENT_B_GPIO, SEGMENT_B_BIT, &HAL_GPIO2_1},
+    {SEGMENT_C_GPIO, SEGMENT_C_BIT, &HAL_GPIO2_2},
+    {SEGMENT_D_GPIO, SEGMENT_D_BIT, &HAL_GPIO2_3},
+    {SEGMENT_E_GPIO, SEGMENT_E_BIT, &HAL_GPIO2_4},
+    {SEGMENT_F_GPIO, SEGMENT_F_BIT, &HAL_GPIO2_5},
+    {SEGMENT_G_GPIO, SEGMENT_G_BIT, &HAL_GPIO2_6},
+    {SEGMENT_P_GPIO, SEGMENT_P_BIT, &HAL_GPIO2_7},
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t DisplayClock(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)now.tv_sec * 1000000UL + (uint32_t)(now.tv_nsec / 1000);
+}
+
+static void DisplayTimerEvent(TimerHandle_t timer) {
+    char text[VIRTUAL_SCREEN_RENDER_SIZE(DISPLAY_DIGITS)];
+    virtual_screen_stats_t stats;
+
+    (void)timer;
+    if (display_timer.handler) {
+        display_timer.handler(display_timer.object);
+    }
+
+    // El dibujo está limitado a DISPLAY_RENDER_RATE, en los demás refrescos solo se registra el encendido del dígito
+    if (VirtualScreenRender(text, sizeof(text))) {
+        VirtualScreenGetStats(&stats);
+        printf("\033[%d;1H%s%lu Hz, jitter %lu us, fantasmas %lu\033[K\n", DISPLAY_RENDER_ROW, text,
+               (unsigned long)stats.refresh_rate, (unsigned long)stats.jitter, (unsigned long)stats.ghosts);
+        fflush(stdout);
+    }
+}
+
+/* === Public function definitions ============================================================================== */
+
+hal_gpio_bit_t BoardPinMap(uint8_t gpio, uint8_t bit) {
+    hal_gpio_bit_t result = NULL;
+
+    for (uint8_t index = 0; index < sizeof(pin_map) / sizeof(pin_map[0]); index++) {
+        if ((pin_map[index].gpio == gpio) && (pin_map[index].bit == bit)) {
+            result = *pin_map[index].pin;
+            break;
+        }
+    }
+    return result;
+}
+
+void BoardPinsInit(void) {
+    // Los terminales emulados no se conectan, el mapa de terminales ya los asigna a cada par puerto y bit
+}
+
+screen_driver_t BoardScreenDriver(screen_driver_t driver) {
+    // La pantalla virtual reemplaza a los terminales de los dígitos, que hal_gpio mostraría en cada escritura
+    (void)driver;
+    return VirtualScreenCreate(DISPLAY_DIGITS, DisplayClock, DISPLAY_RENDER_RATE);
+}
+
+void DisplayTimerStart(board_timer_event_t handler, void * object, uint32_t period) {
+    // Se redondea al tick mas cercano, truncar 3906 us a 3 ms haria parpadear la pantalla un 30% mas rapido
+    TickType_t ticks = ((uint64_t)period * configTICK_RATE_HZ + 500000) / 1000000;
+    TimerHandle_t timer;
+
+    display_timer.handler = handler;
+    display_timer.object = object;
+
+    // No hay interrupción de temporizador, el refresco lo hace el servicio de temporizadores del sistema operativo
+    timer = xTimerCreate("Display", (ticks > 0) ? ticks : 1, pdTRUE, NULL, DisplayTimerEvent);
+    if (timer != NULL) {
+        xTimerStart(timer, 0);
+    }
+}
+
+void KeyEventsStart(board_key_event_t handler, void * object) {
+    // Los cambios del teclado llegan desde un hilo ajeno al sistema operativo, que no puede avisar a las tareas
+    (void)handler;
+    (void)object;
+}
+
+bool KeyEventsEnable(void) {
+    return false;
+}
+
+void SysTickInit(uint16_t ticks) {
+    (void)ticks; // El tick del sistema operativo lo genera el puerto posix de FreeRTOS
+}
+
+#endif
+
+/* === End of documentation ======================================================================================== */
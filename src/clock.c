@@ -23,21 +23,208 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions ==================================================================================== */
 #include "clock.h"
+#include "bcd.h"
 #include <stddef.h>
 #include <string.h>
-#include <stdlib.h>
 
 /* === Header for C++ compatibility ================================================================================ */
 
 /* === Private macros definitions ================================================================================ */
+#define SECONDS_PER_MINUTE 60
+#define SECONDS_PER_HOUR   3600
+#define SECONDS_PER_DAY    86400
+
+#define PHASE_PER_TICK     1000000 // Fraccion de segundo que representa un tick, en millonesimas de tick
+#define DAYS_PER_WEEK      7
+#define DAYS_PER_4_YEARS   1461 // Entre 2000 y 2099 todos los años multiplos de 4 son bisiestos
+
+#define NO_ALARM           0xFF // Indice que indica que no hay alarmas habilitadas
+
+#if CLOCK_MAX_ALARMS > 32
+#error "CLOCK_MAX_ALARMS no puede ser mayor a 32"
+#endif
+
 /* === Private data type declarations ========================================================== */
 
+/**
+ * @brief Entrada de la tabla de alarmas del reloj.
+ */
+typedef struct alarm_entry_s {
+    uint32_t seconds; // Hora de vencimiento en segundos desde las 00:00:00
+    uint8_t id;       // Identificador con el que la aplicacion conoce a la alarma
+    uint8_t parent;   // Alarma que dio origen a una alarma pospuesta, o la misma alarma
+    uint8_t weekdays; // Dias de la semana en que suena, un bit por dia empezando por el domingo
+    bool enabled;
+    bool snooze; // Las alarmas pospuestas suenan una sola vez y se eliminan
+} alarm_entry_t;
+
+struct clock_s {
+    uint32_t clock_ticks;  // Ticks transcurridos dentro del segundo actual
+    uint32_t second_ticks; // Ticks que dura el segundo actual, el valor ideal redondeado hacia arriba o hacia abajo
+    uint32_t phase_offset; // Millonesimas de tick que ya habian transcurrido al empezar el segundo actual
+    uint64_t second_phase; // Duracion ideal de un segundo calibrado, en millonesimas de tick
+    uint16_t ticks_per_second;
+    uint32_t seconds; // Segundos transcurridos desde las 00:00:00
+    uint32_t days;    // Dias transcurridos desde el 1 de enero de CLOCK_MIN_YEAR
+    uint8_t weekday;  // Dia de la semana de la fecha actual, se actualiza junto con days
+    bool valid;
+
+    // Contador de secuencia: es impar mientras una tarea modifica el reloj, las lecturas que lo ven cambiar se repiten
+    uint32_t sequence;
+
+    // Funcion que atiende los eventos del reloj
+    clock_event_handler_t handler;
+    void * handler_object;
+    uint8_t handler_events; // Eventos que se informan a la funcion
+
+    // La hora en BCD la genera quien modifica el reloj al cambiar el segundo, las lecturas solo la copian
+    clock_time_t rendered_time;
+
+    // De aca en adelante es parte de la alarma
+    alarm_entry_t alarms[CLOCK_MAX_ALARMS]; // Tabla de alarmas ordenada por hora de vencimiento
+    uint8_t alarm_count;                    // Cantidad de alarmas cargadas en la tabla
+    uint8_t next_alarm;                     // Indice de la proxima alarma habilitada a vencer
+    uint32_t used_ids;                      // Identificadores de alarma en uso, un bit por identificador
+    uint8_t ringing_alarm;                  // Ultima alarma que sonó, se usa para posponerla
+    bool alarm_triggered;                   // Indica si la alarma esta sonando o no
+};
+
+// Verifica al compilar que la memoria declarada en clock.h alcance para la estructura interna
+typedef char clock_storage_check_t[(sizeof(struct clock_s) <= sizeof(clock_storage_t)) ? 1 : -1];
+
 /* === Private variable declarations =========================================================== */
 
+static struct clock_s instances[CLOCK_MAX_INSTANCES]; // Reserva de relojes que entrega ClockCreate
+static uint8_t instances_used;                        // Cantidad de relojes ya entregados por ClockCreate
+
 /* === Private function declarations =========================================================== */
 
+/**
+ * @brief Inicializa un reloj en la memoria indicada, que puede venir de la reserva o de la aplicación.
+ */
+static clock_t ClockInit(clock_t self, uint16_t ticks_per_second);
+
 static bool IsValidTime(const clock_time_t * time);
 
+/**
+ * @brief Convierte una hora en formato BCD a segundos transcurridos desde las 00:00:00.
+ */
+static uint32_t TimeToSeconds(const clock_time_t * time);
+
+/**
+ * @brief Genera la representación BCD de una cantidad de segundos desde las 00:00:00.
+ */
+static void SecondsToTime(uint32_t seconds, clock_time_t * time);
+
+/**
+ * @brief Verifica que una fecha exista en el calendario y esté dentro del rango soportado.
+ */
+static bool IsValidDate(const clock_date_t * date);
+
+/**
+ * @brief Convierte una fecha a días transcurridos desde el 1 de enero de CLOCK_MIN_YEAR.
+ */
+static uint32_t DateToDays(const clock_date_t * date);
+
+/**
+ * @brief Genera el año, mes y día correspondientes a una cantidad de días desde el 1 de enero de CLOCK_MIN_YEAR.
+ */
+static void DaysToDate(uint32_t days, clock_date_t * date);
+
+/**
+ * @brief Avanza la fecha una cantidad de días, manteniendo el día de la semana sin recalcular la fecha.
+ */
+static void DaysElapsed(clock_t self, uint32_t days);
+
+/**
+ * @brief Calcula cuantos segundos faltan para que venza una hora de alarma.
+ * @return Segundos hasta el vencimiento, entre 1 y un día completo.
+ */
+static uint32_t SecondsUntil(clock_t self, uint32_t seconds);
+
+/**
+ * @brief Calcula cuantos segundos faltan para el próximo vencimiento de la tabla de alarmas.
+ * @return Segundos hasta el vencimiento, entre 1 y un día completo, o 0 si no hay alarmas habilitadas.
+ */
+static uint32_t SecondsUntilAlarm(clock_t self);
+
+/**
+ * @brief Busca en la tabla la próxima alarma habilitada a vencer después de la hora actual.
+ */
+static void SeekNextAlarm(clock_t self);
+
+/**
+ * @brief Busca el indice en la tabla de la alarma con el identificador indicado.
+ * @return Indice de la alarma o NO_ALARM si no existe.
+ */
+static uint8_t FindAlarm(clock_t self, uint8_t id);
+
+/**
+ * @brief Inserta una alarma en la tabla manteniendo el orden por hora de vencimiento.
+ * @return Identificador asignado o CLOCK_INVALID_ALARM si la tabla está llena.
+ */
+static uint8_t InsertAlarm(clock_t self, uint32_t seconds, uint8_t parent, bool enabled, bool snooze);
+
+/**
+ * @brief Elimina de la tabla la alarma ubicada en el indice indicado.
+ */
+static void RemoveAlarmAt(clock_t self, uint8_t index);
+
+/**
+ * @brief Elimina de la tabla las alarmas pospuestas, todas o solo las originadas por una alarma.
+ */
+static void RemoveSnoozes(clock_t self, uint8_t parent);
+
+/**
+ * @brief Dispara todas las alarmas habilitadas que vencen dentro de los próximos segundos indicados en un día de la
+ * semana incluido en su máscara.
+ * @return true si se disparó alguna alarma.
+ */
+static bool FireAlarms(clock_t self, uint32_t elapsed);
+
+/**
+ * @brief Calcula cuantos ticks dura el segundo actual a partir de la fase con que empezó.
+ */
+static void UpdateSecondTicks(clock_t self);
+
+/**
+ * @brief Avanza la fase del reloj una cantidad de ticks.
+ * @return Cantidad de segundos completos transcurridos.
+ */
+static uint32_t PhaseElapsed(clock_t self, uint64_t ticks);
+
+/**
+ * @brief Espera a que no haya una escritura en curso y devuelve el contador de secuencia para validar una lectura.
+ */
+static uint32_t ReadBegin(clock_t self);
+
+/**
+ * @brief Verifica si el reloj se modificó mientras se leía.
+ * @return true si la lectura puede estar mezclada y se debe repetir.
+ */
+static bool ReadRetry(clock_t self, uint32_t sequence);
+
+/**
+ * @brief Toma el reloj para escritura, esperando si otra tarea lo está modificando.
+ */
+static void WriteBegin(clock_t self);
+
+/**
+ * @brief Libera el reloj al terminar una escritura.
+ */
+static void WriteEnd(clock_t self);
+
+/**
+ * @brief Avanza el reloj una cantidad de segundos y verifica si alguna alarma debe sonar.
+ * @return Eventos ocurridos en el intervalo avanzado, combinación de valores de clock_event_t.
+ */
+static uint8_t SecondsElapsed(clock_t self, uint32_t elapsed);
+
+/**
+ * @brief Informa los eventos ocurridos a la función instalada, si se pidió atender alguno de ellos.
+ */
+static void NotifyEvents(clock_t self, uint8_t events);
+
 /* === Public macros definitions =================================================================================== */
 
 /* === Public data type declarations =============================================================================== */
@@ -50,72 +237,371 @@ static bool IsValidTime(const clock_time_t * time);
 
 /* === Private variable definitions ============================================================ */
 
+// Dias transcurridos desde el inicio del año hasta el primero de cada mes, en un año no bisiesto
+static const uint16_t DAYS_BEFORE_MONTH[13] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365};
+
+// Dias desde el inicio de un bloque de cuatro años hasta el inicio de cada año, el primero es el bisiesto
+static const uint16_t DAYS_BEFORE_YEAR[5] = {0, 366, 731, 1096, DAYS_PER_4_YEARS};
+
 /* === Private function implementation ========================================================= */
 
 static bool IsValidTime(const clock_time_t * time) {
-    if (!time)
-        return false;
+    return time && BcdIsValid(BcdLoad(time));
+}
 
-    // validacion de segundos
-    if (time->time.seconds[0] > 9 || time->time.seconds[1] > 5)
-        return false;
+static uint32_t TimeToSeconds(const clock_time_t * time) {
+    uint32_t hours = time->time.hours[1] * 10 + time->time.hours[0];
+    uint32_t minutes = time->time.minutes[1] * 10 + time->time.minutes[0];
+    uint32_t seconds = time->time.seconds[1] * 10 + time->time.seconds[0];
 
-    // validacion de minutos
-    if (time->time.minutes[0] > 9 || time->time.minutes[1] > 5)
-        return false;
+    return hours * SECONDS_PER_HOUR + minutes * SECONDS_PER_MINUTE + seconds;
+}
 
-    // validacion de horas
-    if (time->time.hours[0] > 9 || time->time.hours[1] > 2 || (time->time.hours[1] == 2 && time->time.hours[0] > 3)) {
+static void SecondsToTime(uint32_t seconds, clock_time_t * time) {
+    uint8_t hours = seconds / SECONDS_PER_HOUR;
+    uint8_t minutes = (seconds / SECONDS_PER_MINUTE) % 60;
+    seconds = seconds % 60;
+
+    time->time.hours[1] = hours / 10;
+    time->time.hours[0] = hours % 10;
+    time->time.minutes[1] = minutes / 10;
+    time->time.minutes[0] = minutes % 10;
+    time->time.seconds[1] = seconds / 10;
+    time->time.seconds[0] = seconds % 10;
+}
+
+static bool IsValidDate(const clock_date_t * date) {
+    if (date->year < CLOCK_MIN_YEAR || date->year > CLOCK_MAX_YEAR || date->month < 1 || date->month > 12) {
         return false;
     }
 
-    return true;
+    uint8_t month_days = DAYS_BEFORE_MONTH[date->month] - DAYS_BEFORE_MONTH[date->month - 1];
+    if (date->month == 2 && (date->year % 4) == 0) {
+        month_days++;
+    }
+    return date->day >= 1 && date->day <= month_days;
 }
 
-/* === Public function implementation ========================================================= */
-struct clock_s {
-    uint16_t clock_ticks;
-    clock_time_t current_time;
-    bool valid;
-    uint16_t ticks_per_second;
+static uint32_t DateToDays(const clock_date_t * date) {
+    uint16_t years = date->year - CLOCK_MIN_YEAR;
+    uint32_t days = (years / 4) * DAYS_PER_4_YEARS + DAYS_BEFORE_YEAR[years % 4];
 
-    // De aca en adelante es parte de la alarma
-    clock_time_t alarm_time;
-    bool alarm_enabled;
-    bool alarm_triggered;      // Indica si la alarma esta sonando o no
-    clock_time_t snoozed_time; // Guarda la hora de la alarma pospuesta
-    bool snoozed_active;       // Indica si la alarma pospuesta esta activa
-};
+    days += DAYS_BEFORE_MONTH[date->month - 1] + date->day - 1;
+    if (date->month > 2 && (years % 4) == 0) {
+        days++; // 29 de febrero
+    }
+    return days;
+}
 
-clock_t ClockCreate(uint16_t ticks_per_second) {
+static void DaysToDate(uint32_t days, clock_date_t * date) {
+    uint8_t year = 0;
+    uint8_t month = 1;
+    uint16_t day_of_year;
 
-    if (ticks_per_second < 1) {
-        return NULL; // No se puede crear un reloj con menos de 1 tick por segundo
+    // Se ubica el año dentro del bloque de cuatro años, el primero de cada bloque es el bisiesto
+    uint32_t day_of_block = days % DAYS_PER_4_YEARS;
+    while (day_of_block >= DAYS_BEFORE_YEAR[year + 1]) {
+        year++;
+    }
+    day_of_year = day_of_block - DAYS_BEFORE_YEAR[year];
+
+    if (year == 0 && day_of_year >= DAYS_BEFORE_MONTH[2]) {
+        if (day_of_year == DAYS_BEFORE_MONTH[2]) {
+            month = 2; // 29 de febrero
+            day_of_year = 28;
+        } else {
+            day_of_year--; // Despues del 29 de febrero se cuenta como un año comun
+        }
+    }
+    if (month == 1) {
+        while (day_of_year >= DAYS_BEFORE_MONTH[month]) {
+            month++;
+        }
+        day_of_year -= DAYS_BEFORE_MONTH[month - 1];
     }
 
-    clock_t self = malloc(sizeof(struct clock_s));
-    if (self == NULL) {
-        return NULL;
+    date->year = CLOCK_MIN_YEAR + (days / DAYS_PER_4_YEARS) * 4 + year;
+    date->month = month;
+    date->day = day_of_year + 1;
+}
+
+static void DaysElapsed(clock_t self, uint32_t days) {
+    self->days += days;
+    self->weekday = (self->weekday + days % DAYS_PER_WEEK) % DAYS_PER_WEEK;
+}
+
+static uint32_t SecondsUntil(clock_t self, uint32_t seconds) {
+    uint32_t distance = (seconds + SECONDS_PER_DAY - self->seconds) % SECONDS_PER_DAY;
+
+    return distance ? distance : SECONDS_PER_DAY; // Si la hora coincide ahora, el proximo vencimiento es mañana
+}
+
+static uint32_t SecondsUntilAlarm(clock_t self) {
+    if (self->next_alarm == NO_ALARM) {
+        return 0;
+    }
+    return SecondsUntil(self, self->alarms[self->next_alarm].seconds);
+}
+
+static void SeekNextAlarm(clock_t self) {
+    uint8_t first = NO_ALARM;
+
+    // Como la tabla esta ordenada, la proxima alarma es la primera habilitada despues de la hora actual o, si no hay
+    // ninguna, la primera habilitada del dia siguiente
+    for (uint8_t index = 0; index < self->alarm_count; index++) {
+        if (self->alarms[index].enabled) {
+            if (self->alarms[index].seconds > self->seconds) {
+                self->next_alarm = index;
+                return;
+            }
+            if (first == NO_ALARM) {
+                first = index;
+            }
+        }
+    }
+    self->next_alarm = first;
+}
+
+static uint8_t FindAlarm(clock_t self, uint8_t id) {
+    for (uint8_t index = 0; index < self->alarm_count; index++) {
+        if (self->alarms[index].id == id) {
+            return index;
+        }
+    }
+    return NO_ALARM;
+}
+
+static uint8_t InsertAlarm(clock_t self, uint32_t seconds, uint8_t parent, bool enabled, bool snooze) {
+    uint8_t id = 0;
+    uint8_t index = self->alarm_count;
+
+    if (self->alarm_count == CLOCK_MAX_ALARMS) {
+        return CLOCK_INVALID_ALARM;
+    }
+    while (self->used_ids & (1UL << id)) {
+        id++;
+    }
+
+    // Se desplazan las alarmas que vencen despues para mantener la tabla ordenada
+    while (index > 0 && self->alarms[index - 1].seconds > seconds) {
+        self->alarms[index] = self->alarms[index - 1];
+        index--;
+    }
+    self->alarms[index] = (alarm_entry_t){
+        .seconds = seconds,
+        .id = id,
+        .parent = (parent == CLOCK_INVALID_ALARM) ? id : parent,
+        .weekdays = CLOCK_EVERY_DAY,
+        .enabled = enabled,
+        .snooze = snooze,
+    };
+    self->alarm_count++;
+    self->used_ids |= (1UL << id);
+
+    SeekNextAlarm(self);
+    return id;
+}
+
+static void RemoveAlarmAt(clock_t self, uint8_t index) {
+    self->used_ids &= ~(1UL << self->alarms[index].id);
+    self->alarm_count--;
+    memmove(&self->alarms[index], &self->alarms[index + 1], (self->alarm_count - index) * sizeof(alarm_entry_t));
+}
+
+static void RemoveSnoozes(clock_t self, uint8_t parent) {
+    uint8_t index = 0;
+
+    while (index < self->alarm_count) {
+        alarm_entry_t * entry = &self->alarms[index];
+        if (entry->snooze && (parent == CLOCK_INVALID_ALARM || entry->parent == parent)) {
+            RemoveAlarmAt(self, index);
+        } else {
+            index++;
+        }
+    }
+    SeekNextAlarm(self);
+}
+
+static bool FireAlarms(clock_t self, uint32_t elapsed) {
+    uint8_t index = 0;
+    bool fired = false;
+
+    while (index < self->alarm_count) {
+        alarm_entry_t * entry = &self->alarms[index];
+        bool due = false;
+
+        // Si el intervalo abarca varios dias se revisa cada vencimiento, como mucho uno por dia de la semana
+        uint32_t distance = SecondsUntil(self, entry->seconds);
+        for (uint8_t day = 0; entry->enabled && !due && day < DAYS_PER_WEEK && distance <= elapsed; day++) {
+            uint8_t weekday = (self->weekday + (self->seconds + distance) / SECONDS_PER_DAY) % DAYS_PER_WEEK;
+            due = (entry->weekdays & CLOCK_DAY_MASK(weekday));
+            distance += SECONDS_PER_DAY;
+        }
+
+        if (due) {
+            fired = true;
+            self->alarm_triggered = true;
+            self->ringing_alarm = entry->parent;
+            if (entry->snooze) {
+                RemoveAlarmAt(self, index); // Se desactiva una vez que se disparó
+                continue;
+            }
+        }
+        index++;
+    }
+    return fired;
+}
+
+static void UpdateSecondTicks(clock_t self) {
+    // El segundo termina con el primer tick que alcanza su duracion ideal, asi cada segundo dura el valor ideal
+    // redondeado hacia arriba o hacia abajo y el error de redondeo pasa al segundo siguiente sin acumularse
+    self->second_ticks = (self->second_phase - self->phase_offset + PHASE_PER_TICK - 1) / PHASE_PER_TICK;
+}
+
+static uint32_t PhaseElapsed(clock_t self, uint64_t ticks) {
+    uint64_t phase = (uint64_t)self->clock_ticks * PHASE_PER_TICK + self->phase_offset + ticks * PHASE_PER_TICK;
+    uint64_t seconds = phase / self->second_phase;
+
+    phase = phase % self->second_phase;
+    self->clock_ticks = phase / PHASE_PER_TICK;
+    self->phase_offset = phase % PHASE_PER_TICK;
+    UpdateSecondTicks(self);
+    return seconds;
+}
+
+static uint32_t ReadBegin(clock_t self) {
+    uint32_t sequence;
+
+    do {
+        sequence = __atomic_load_n(&self->sequence, __ATOMIC_ACQUIRE);
+    } while (sequence & 1);
+    return sequence;
+}
+
+static bool ReadRetry(clock_t self, uint32_t sequence) {
+    // La barrera evita que las lecturas de los datos se reordenen despues de la del contador
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&self->sequence, __ATOMIC_RELAXED) != sequence;
+}
+
+static void WriteBegin(clock_t self) {
+    uint32_t sequence;
+
+#ifdef CLOCK_CRITICAL_HOOKS
+    // Con un solo nucleo ninguna otra tarea puede ejecutar hasta WriteEnd, asi una lectura de mayor prioridad nunca
+    // encuentra el contador impar y la espera de abajo solo puede ocurrir entre nucleos distintos
+    ClockCriticalEnter();
+#endif
+    do {
+        sequence = __atomic_load_n(&self->sequence, __ATOMIC_RELAXED) & ~1U;
+    } while (!__atomic_compare_exchange_n(&self->sequence, &sequence, sequence + 1, false, __ATOMIC_ACQUIRE,
+                                          __ATOMIC_RELAXED));
+    // La barrera evita que las escrituras de los datos se adelanten a la del contador
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static void WriteEnd(clock_t self) {
+    __atomic_fetch_add(&self->sequence, 1, __ATOMIC_RELEASE);
+#ifdef CLOCK_CRITICAL_HOOKS
+    ClockCriticalExit();
+#endif
+}
+
+static uint8_t SecondsElapsed(clock_t self, uint32_t elapsed) {
+    uint8_t events = CLOCK_EVENT_SECOND;
+
+    if (elapsed == 0) {
+        return 0;
+    }
+    if (self->seconds % SECONDS_PER_MINUTE + elapsed >= SECONDS_PER_MINUTE) {
+        events |= CLOCK_EVENT_MINUTE;
+    }
+
+    // Solo se compara la proxima alarma de la tabla con el intervalo avanzado, asi el costo por segundo no depende de
+    // la cantidad de alarmas y no se pierde ninguna aunque el reloj salte varios segundos de una vez. La mascara de
+    // dias de la semana se revisa solo cuando se alcanza la alarma
+    uint32_t distance = SecondsUntilAlarm(self);
+    bool reached = (distance && distance <= elapsed);
+    if (reached && FireAlarms(self, elapsed)) {
+        events |= CLOCK_EVENT_ALARM;
+    }
+
+    uint32_t days = elapsed / SECONDS_PER_DAY;
+    self->seconds += elapsed % SECONDS_PER_DAY;
+    if (self->seconds >= SECONDS_PER_DAY) {
+        self->seconds -= SECONDS_PER_DAY; // Rollover 23:59:59 -> 00:00:00
+        days++;
+    }
+    if (days) {
+        DaysElapsed(self, days);
+    }
+    if (reached) {
+        SeekNextAlarm(self);
+    }
+    SecondsToTime(self->seconds, &self->rendered_time);
+
+    return events;
+}
+
+static void NotifyEvents(clock_t self, uint8_t events) {
+    events &= self->handler_events;
+    if (events && self->handler) {
+        self->handler(self, events, self->handler_object);
     }
-    memset(self, 0, sizeof(struct clock_s)); // Inicializar a cero
+}
+
+static clock_t ClockInit(clock_t self, uint16_t ticks_per_second) {
+    memset(self, 0, sizeof(struct clock_s)); // Inicializar a cero, la cache BCD queda valida para las 00:00:00
 
     self->ticks_per_second = ticks_per_second;
+    self->second_phase = (uint64_t)ticks_per_second * PHASE_PER_TICK;
+    self->second_ticks = ticks_per_second;
     self->valid = false;
+    self->weekday = CLOCK_MIN_YEAR_WEEKDAY;
 
-    // Alarma
-    self->alarm_enabled = false;
-    self->alarm_triggered = false;
+    // La alarma principal siempre existe en la tabla, empieza deshabilitada a las 00:00:00
+    self->next_alarm = NO_ALARM;
+    InsertAlarm(self, 0, CLOCK_INVALID_ALARM, false, false);
+    self->ringing_alarm = CLOCK_MAIN_ALARM;
 
     return self;
 }
 
+/* === Public function implementation ========================================================= */
+clock_t ClockCreate(uint16_t ticks_per_second) {
+
+    if (ticks_per_second < 1) {
+        return NULL; // No se puede crear un reloj con menos de 1 tick por segundo
+    }
+    if (instances_used >= CLOCK_MAX_INSTANCES) {
+        return NULL;
+    }
+    return ClockInit(&instances[instances_used++], ticks_per_second);
+}
+
+clock_t ClockCreateStatic(clock_storage_t * storage, uint16_t ticks_per_second) {
+    if ((storage == NULL) || (ticks_per_second < 1)) {
+        return NULL;
+    }
+    return ClockInit((clock_t)storage, ticks_per_second);
+}
+
 bool ClockGetTime(clock_t self, clock_time_t * result) {
+    uint32_t sequence;
+    bool valid;
+
     if (!self || !result) {
         return false;
     }
 
-    memcpy(result, &self->current_time, sizeof(clock_time_t));
-    return self->valid;
+    // La lectura nunca escribe el reloj, asi una tarea de mayor prioridad no puede dejar esperando a las demas
+    do {
+        sequence = ReadBegin(self);
+        valid = self->valid;
+        memcpy(result, &self->rendered_time, sizeof(clock_time_t));
+    } while (ReadRetry(self, sequence));
+
+    return valid;
 }
 
 bool ClockSetTime(clock_t self, const clock_time_t * new_time) {
@@ -123,8 +609,12 @@ bool ClockSetTime(clock_t self, const clock_time_t * new_time) {
         return false;
     }
 
-    memcpy(&self->current_time, new_time, sizeof(*new_time));
+    WriteBegin(self);
+    self->seconds = TimeToSeconds(new_time);
+    memcpy(&self->rendered_time, new_time, sizeof(*new_time));
     self->valid = true;
+    SeekNextAlarm(self);
+    WriteEnd(self);
 
     return true;
 }
@@ -132,150 +622,329 @@ bool ClockSetTime(clock_t self, const clock_time_t * new_time) {
 void ClockNewTick(clock_t self) {
     if (!self || !self->valid)
         return;
-    // Incrementar el contador de ticks del reloj
-    self->clock_ticks++;
-    if (self->clock_ticks == self->ticks_per_second) {
-        self->clock_ticks = 0;
-        self->current_time.time.seconds[0]++;
-
-        // Rollover segundos (unidades)
-        if (self->current_time.time.seconds[0] > 9) {
-            self->current_time.time.seconds[0] = 0;
-            self->current_time.time.seconds[1]++;
-
-            // Rollover segundos (decenas)
-            if (self->current_time.time.seconds[1] > 5) {
-                self->current_time.time.seconds[1] = 0;
-                self->current_time.time.minutes[0]++;
-
-                // Rollover minutos (unidades)
-                if (self->current_time.time.minutes[0] > 9) {
-                    self->current_time.time.minutes[0] = 0;
-                    self->current_time.time.minutes[1]++;
-
-                    // Rollover minutos (decenas)
-                    if (self->current_time.time.minutes[1] > 5) {
-                        self->current_time.time.minutes[1] = 0;
-                        self->current_time.time.hours[0]++;
-
-                        // Rollover horas (unidades)
-                        if (self->current_time.time.hours[0] > 9) {
-                            self->current_time.time.hours[0] = 0;
-                            self->current_time.time.hours[1]++;
-                        }
-                        // Rollover horas completo (23:59:59 -> 00:00:00)
-                        if (self->current_time.time.hours[1] > 2 ||
-                            (self->current_time.time.hours[1] == 2 && self->current_time.time.hours[0] > 3)) {
-                            // Volver a 00:00:00 si pasa de 23:59:59
-                            // memset(&self->current_time, 0, sizeof(clock_time_t)); ->NO USO PORQUE ME PUEDE ROMPER
-                            // LA ALARMA
-                            self->current_time.time.seconds[0] = 0;
-                            self->current_time.time.seconds[1] = 0;
-                            self->current_time.time.minutes[0] = 0;
-                            self->current_time.time.minutes[1] = 0;
-                            self->current_time.time.hours[0] = 0;
-                            self->current_time.time.hours[1] = 0;
-                        }
-                    }
-                }
+    // Incrementar el contador de ticks del reloj, el resto del trabajo se hace una vez por segundo. Como el tiempo lo
+    // avanza una sola tarea, el contador de ticks no necesita tomar el reloj y solo se toma al cambiar el segundo
+    if (++self->clock_ticks >= self->second_ticks) {
+        WriteBegin(self);
+        uint8_t events = SecondsElapsed(self, PhaseElapsed(self, 0));
+        WriteEnd(self);
+        NotifyEvents(self, events); // Despues de liberar el reloj, para que la funcion lo pueda consultar
+    }
+}
+
+bool ClockAdvanceTicks(clock_t self, uint32_t ticks) {
+    uint8_t events;
+
+    if (!self || !self->valid) {
+        return false;
+    }
+
+    WriteBegin(self);
+    events = SecondsElapsed(self, PhaseElapsed(self, ticks));
+    WriteEnd(self);
+    NotifyEvents(self, events);
+
+    return (events & CLOCK_EVENT_ALARM);
+}
+
+uint32_t ClockTicksUntilNextEvent(clock_t self, uint8_t events) {
+    uint32_t sequence;
+    uint32_t seconds;
+    uint64_t phase;
+    uint64_t second_phase;
+
+    if (!self) {
+        return 0;
+    }
+
+    do {
+        sequence = ReadBegin(self);
+        seconds = SECONDS_PER_DAY; // Segundos completos a esperar despues de que termine el segundo actual
+        phase = (uint64_t)self->clock_ticks * PHASE_PER_TICK + self->phase_offset;
+        second_phase = self->second_phase;
+
+        if (self->valid) {
+            uint32_t minute_left = SECONDS_PER_MINUTE - 1 - self->seconds % SECONDS_PER_MINUTE;
+
+            if (events & CLOCK_EVENT_SECOND) {
+                seconds = 0;
+            }
+            if ((events & CLOCK_EVENT_MINUTE) && (minute_left < seconds)) {
+                seconds = minute_left;
+            }
+            uint32_t distance = SecondsUntilAlarm(self);
+            if ((events & CLOCK_EVENT_ALARM) && distance && (distance - 1 < seconds)) {
+                seconds = distance - 1;
             }
         }
+    } while (ReadRetry(self, sequence));
+
+    if (seconds == SECONDS_PER_DAY) {
+        seconds = 0;
     }
 
-    // Verificar si la alarma (normal o pospuesta) debe sonar
-    if (self->alarm_enabled) {
-        clock_time_t * target = self->snoozed_active ? &self->snoozed_time : &self->alarm_time;
+    uint64_t remaining = (seconds + 1) * second_phase - phase;
+    uint64_t ticks = (remaining + PHASE_PER_TICK - 1) / PHASE_PER_TICK;
+    return ticks > UINT32_MAX ? UINT32_MAX : (uint32_t)ticks;
+}
 
-        if (ClockTimesMatch(&self->current_time, target)) {
-            self->alarm_triggered = true;
-            self->snoozed_active = false; // Se desactiva una vez que se disparó
-        }
+bool ClockSetEventHandler(clock_t self, clock_event_handler_t handler, void * object, uint8_t events) {
+    if (!self) {
+        return false;
     }
+
+    WriteBegin(self);
+    self->handler = handler;
+    self->handler_object = object;
+    self->handler_events = events;
+    WriteEnd(self);
+    return true;
+}
+
+bool ClockSetCalibration(clock_t self, int32_t ppm) {
+    if (!self || ppm > CLOCK_MAX_CALIBRATION_PPM || ppm < -CLOCK_MAX_CALIBRATION_PPM) {
+        return false;
+    }
+
+    WriteBegin(self);
+    self->second_phase = (uint64_t)self->ticks_per_second * (PHASE_PER_TICK + ppm);
+    UpdateSecondTicks(self); // Si el segundo actual ya duró mas que la nueva duración termina en el proximo tick
+    WriteEnd(self);
+    return true;
 }
 
-// Guarda una copia de la hora de la alarma (alarm_time) en el reloj.
+// Cambia la hora de la alarma principal.
 bool ClockSetAlarmTime(clock_t self, const clock_time_t * alarm_time) {
     if (!self || !alarm_time || !IsValidTime(alarm_time)) {
         return false;
     }
 
-    memcpy(&self->alarm_time, alarm_time, sizeof(clock_time_t));
+    WriteBegin(self);
+    uint8_t index = FindAlarm(self, CLOCK_MAIN_ALARM);
+    alarm_entry_t main_alarm = self->alarms[index];
+
+    // Se saca y se vuelve a insertar para mantener la tabla ordenada, conservando el identificador y los dias
+    RemoveAlarmAt(self, index);
+    InsertAlarm(self, TimeToSeconds(alarm_time), CLOCK_INVALID_ALARM, main_alarm.enabled, false);
+    self->alarms[FindAlarm(self, CLOCK_MAIN_ALARM)].weekdays = main_alarm.weekdays;
+    WriteEnd(self);
     return true;
 }
 
-// Obtiene la hora de la alarma (alarm_time) del reloj y la almacena en alarm_time.
+// Obtiene la hora de la alarma principal y la almacena en alarm_time.
 bool ClockGetAlarmTime(clock_t self, clock_time_t * alarm_time) {
+    uint32_t sequence;
+    uint32_t seconds;
+
     if (!self || !alarm_time) {
         return false;
     }
-    memcpy(alarm_time, &self->alarm_time, sizeof(clock_time_t));
+
+    do {
+        sequence = ReadBegin(self);
+        seconds = self->alarms[FindAlarm(self, CLOCK_MAIN_ALARM)].seconds;
+    } while (ReadRetry(self, sequence));
+
+    SecondsToTime(seconds, alarm_time);
     return true;
 }
 
 void ClockEnableAlarm(clock_t self) {
 
     if (self && self->valid) {
-        self->alarm_enabled = true;
+        ClockEnableAlarmById(self, CLOCK_MAIN_ALARM);
     }
 }
 
 void ClockDisableAlarm(clock_t self) {
     if (self && self->valid) {
-        self->alarm_enabled = false;
+        ClockDisableAlarmById(self, CLOCK_MAIN_ALARM);
     }
 }
 
 bool ClockIsAlarmEnabled(clock_t self) {
-    return self ? self->alarm_enabled : false;
+    uint32_t sequence;
+    bool enabled;
+
+    if (!self) {
+        return false;
+    }
+
+    do {
+        sequence = ReadBegin(self);
+        enabled = self->alarms[FindAlarm(self, CLOCK_MAIN_ALARM)].enabled;
+    } while (ReadRetry(self, sequence));
+
+    return enabled;
 }
 
 bool ClockIsAlarmTriggered(clock_t self) {
     return self ? self->alarm_triggered : false;
 }
 
-bool ClockTimesMatch(const clock_time_t * a, const clock_time_t * b) {
-    for (int i = 0; i < 6; i++) {
-        if (a->bcd[i] != b->bcd[i]) {
-            return false;
+uint8_t ClockAddAlarm(clock_t self, const clock_time_t * alarm_time) {
+    uint8_t id;
+
+    if (!self || !alarm_time || !IsValidTime(alarm_time)) {
+        return CLOCK_INVALID_ALARM;
+    }
+
+    WriteBegin(self);
+    id = InsertAlarm(self, TimeToSeconds(alarm_time), CLOCK_INVALID_ALARM, true, false);
+    WriteEnd(self);
+    return id;
+}
+
+bool ClockRemoveAlarm(clock_t self, uint8_t id) {
+    if (!self || id == CLOCK_MAIN_ALARM) {
+        return false;
+    }
+
+    WriteBegin(self);
+    uint8_t index = FindAlarm(self, id);
+    if (index != NO_ALARM) {
+        RemoveAlarmAt(self, index);
+        RemoveSnoozes(self, id); // Tambien busca la proxima alarma
+    }
+    WriteEnd(self);
+    return (index != NO_ALARM);
+}
+
+bool ClockEnableAlarmById(clock_t self, uint8_t id) {
+    if (!self) {
+        return false;
+    }
+
+    WriteBegin(self);
+    uint8_t index = FindAlarm(self, id);
+    if (index != NO_ALARM) {
+        self->alarms[index].enabled = true;
+        SeekNextAlarm(self);
+    }
+    WriteEnd(self);
+    return (index != NO_ALARM);
+}
+
+bool ClockDisableAlarmById(clock_t self, uint8_t id) {
+    if (!self) {
+        return false;
+    }
+
+    WriteBegin(self);
+    uint8_t index = FindAlarm(self, id);
+    if (index != NO_ALARM) {
+        self->alarms[index].enabled = false;
+        RemoveSnoozes(self, id); // Una alarma deshabilitada tampoco suena pospuesta
+    }
+    WriteEnd(self);
+    return (index != NO_ALARM);
+}
+
+uint8_t ClockGetAlarmCount(clock_t self) {
+    return self ? self->alarm_count : 0;
+}
+
+bool ClockGetAlarm(clock_t self, uint8_t index, clock_alarm_info_t * info) {
+    uint32_t sequence;
+    alarm_entry_t entry;
+    bool found;
+
+    if (!self || !info) {
+        return false;
+    }
+
+    do {
+        sequence = ReadBegin(self);
+        found = (index < self->alarm_count);
+        if (found) {
+            entry = self->alarms[index];
         }
+    } while (ReadRetry(self, sequence));
+
+    if (found) {
+        info->id = entry.id;
+        info->enabled = entry.enabled;
+        info->snooze = entry.snooze;
+        info->weekdays = entry.weekdays;
+        SecondsToTime(entry.seconds, &info->time);
+    }
+    return found;
+}
+
+bool ClockSetAlarmWeekdays(clock_t self, uint8_t id, uint8_t weekdays) {
+    if (!self || (weekdays & ~CLOCK_EVERY_DAY)) {
+        return false;
     }
+
+    WriteBegin(self);
+    uint8_t index = FindAlarm(self, id);
+    if (index != NO_ALARM) {
+        self->alarms[index].weekdays = weekdays;
+    }
+    WriteEnd(self);
+    return (index != NO_ALARM);
+}
+
+bool ClockSetDate(clock_t self, const clock_date_t * date) {
+    if (!self || !date || !IsValidDate(date)) {
+        return false;
+    }
+
+    uint32_t days = DateToDays(date);
+    WriteBegin(self);
+    self->days = days;
+    self->weekday = (CLOCK_MIN_YEAR_WEEKDAY + days) % DAYS_PER_WEEK;
+    WriteEnd(self);
     return true;
 }
 
-bool ClockSnoozeAlarm(clock_t self, uint8_t minutes_to_snooze) {
+bool ClockGetDate(clock_t self, clock_date_t * date) {
+    uint32_t sequence;
+    uint32_t days;
+    uint8_t weekday;
 
-    if (!self || !self->valid || minutes_to_snooze == 0) {
+    if (!self || !date) {
         return false;
     }
 
-    // Tomamos la hora actual como punto de partida
-    uint8_t min_units = self->current_time.time.minutes[0];
-    uint8_t min_tens = self->current_time.time.minutes[1];
-    uint8_t hr_units = self->current_time.time.hours[0];
-    uint8_t hr_tens = self->current_time.time.hours[1];
+    do {
+        sequence = ReadBegin(self);
+        days = self->days;
+        weekday = self->weekday;
+    } while (ReadRetry(self, sequence));
+
+    // El año, mes y dia se calculan solo cuando se los pide
+    DaysToDate(days, date);
+    date->weekday = weekday;
+    return true;
+}
+
+uint8_t ClockGetWeekday(clock_t self) {
+    return self ? self->weekday : 0;
+}
 
-    uint8_t current_minutes = min_tens * 10 + min_units;
-    uint8_t current_hours = hr_tens * 10 + hr_units;
+bool ClockTimesMatch(const clock_time_t * a, const clock_time_t * b) {
+    return BcdCompare(BcdLoad(a), BcdLoad(b)) == 0;
+}
 
-    uint16_t total_minutes = current_minutes + minutes_to_snooze;
-    uint16_t new_hours = current_hours + (total_minutes / 60);
-    uint16_t new_minutes = total_minutes % 60;
+bool ClockSnoozeAlarm(clock_t self, uint8_t minutes_to_snooze) {
 
-    if (new_hours >= 24) {
-        new_hours %= 24;
+    if (!self || !self->valid || minutes_to_snooze == 0) {
+        return false;
     }
 
-    self->snoozed_time.time.hours[1] = new_hours / 10;
-    self->snoozed_time.time.hours[0] = new_hours % 10;
-    self->snoozed_time.time.minutes[1] = new_minutes / 10;
-    self->snoozed_time.time.minutes[0] = new_minutes % 10;
-    self->snoozed_time.time.seconds[1] = 0;
-    self->snoozed_time.time.seconds[0] = 0;
+    // Tomamos la hora actual como punto de partida, descartando los segundos
+    WriteBegin(self);
+    uint32_t current_minutes = self->seconds / SECONDS_PER_MINUTE;
+    uint32_t snoozed_seconds = ((current_minutes + minutes_to_snooze) * SECONDS_PER_MINUTE) % SECONDS_PER_DAY;
 
-    self->snoozed_active = true;
-    self->alarm_triggered = false; // Reinicia la alarma al posponer
+    bool snoozed = (InsertAlarm(self, snoozed_seconds, self->ringing_alarm, true, true) != CLOCK_INVALID_ALARM);
+    if (snoozed) {
+        self->alarm_triggered = false; // Reinicia la alarma al posponer
+    }
+    WriteEnd(self);
 
-    return true;
+    return snoozed;
 }
 
 bool ClockCancelAlarmUntilNextDay(clock_t self) {
@@ -283,8 +952,10 @@ bool ClockCancelAlarmUntilNextDay(clock_t self) {
         return false;
     }
 
-    self->alarm_triggered = false; // Detiene el sonido actual
-    self->snoozed_active = false;  // Por si estaba pospuesta
+    WriteBegin(self);
+    self->alarm_triggered = false;            // Detiene el sonido actual
+    RemoveSnoozes(self, self->ringing_alarm); // Por si estaba pospuesta, las de otras alarmas se mantienen
+    WriteEnd(self);
 
     return true;
 }
@@ -22,15 +22,17 @@ SPDX-License-Identifier: MIT
  **/
 
 /* === Headers files inclusions ==================================================================================== */
+#include <stddef.h>
 #include <string.h>
 #include "digital.h"
-#include <stdlib.h>
 #include "config.h"
 #include <stdbool.h>
-#include "chip.h"
+#include "digital_port.h"
 
 /* === Macros definitions ========================================================================================== */
 
+#define GESTURE_ACCELERATION 3 // Cada repetición acorta el intervalo en 1/2^GESTURE_ACCELERATION
+
 /* === Private data type declarations ============================================================================== */
 
 struct digital_output_s {
@@ -46,57 +48,384 @@ struct digital_input_s {
     bool lastState; /*! Último estado conocido de la entrada */
 }; /*!< Estructura que representa una entrada digital */
 
+struct digital_output_group_s {
+    uint32_t pins[DIGITAL_OUTPUT_GROUP_MAX_OUTPUTS]; /*!< Terminal de cada salida en su puerto */
+    uint8_t slot[DIGITAL_OUTPUT_GROUP_MAX_OUTPUTS];  /*!< Posición del puerto de cada salida en el grupo */
+    uint8_t gpio[DIGITAL_OUTPUT_GROUP_MAX_PORTS];    /*!< Puerto que ocupa cada posición del grupo */
+    digital_outputs_t high;                          /*!< Salidas que ponen el terminal en alto al desactivarse */
+    uint8_t count;                                   /*!< Cantidad de salidas agregadas */
+    uint8_t ports;                                   /*!< Posiciones de puerto ocupadas */
+}; /*!< Estructura que representa un grupo de salidas digitales */
+
+struct digital_input_group_s {
+    uint32_t mask[DIGITAL_GROUP_MAX_PORTS];                           /*!< Terminales de cada puerto del grupo */
+    uint32_t invert[DIGITAL_GROUP_MAX_PORTS];                         /*!< Terminales de cada puerto invertidos */
+    uint32_t count[DIGITAL_GROUP_MAX_PORTS][DIGITAL_DEBOUNCE_PLANES]; /*!< Contadores verticales del antirrebote */
+    digital_keys_t state;                                             /*!< Entradas activas ya filtradas */
+    digital_keys_t activated;                                         /*!< Entradas que se activaron en el muestreo */
+    digital_keys_t deactivated;                                       /*!< Entradas que se soltaron en el muestreo */
+    uint8_t gpio[DIGITAL_GROUP_MAX_PORTS];                            /*!< Puerto que ocupa cada posición del grupo */
+    uint8_t ports;                                                    /*!< Posiciones de puerto ocupadas */
+    uint8_t samples;                                                  /*!< Muestras que tiene que durar un cambio */
+}; /*!< Estructura que representa un grupo de entradas digitales */
+
+// Fases del reconocimiento de gestos de una tecla
+typedef enum gesture_phase_e {
+    GESTURE_IDLE = 0, // Tecla suelta
+    GESTURE_DOWN,     // Tecla presionada, todavía no se reconoció ningún gesto
+    GESTURE_HELD,     // Ya se entregó la presión larga o doble, se espera que se suelte
+    GESTURE_REPEAT,   // Tecla mantenida que repite
+    GESTURE_RELEASED, // Tecla soltada que espera una segunda presión
+} gesture_phase_t;
+
+struct gesture_key_s {
+    uint16_t mark;       /*!< Último cambio o última repetición, en los 16 bits bajos del tiempo */
+    uint16_t interval;   /*!< Tiempo hasta la próxima repetición */
+    uint8_t key;         /*!< Posición de la tecla en la máscara del grupo */
+    uint8_t phase : 3;   /*!< Fase del reconocimiento, uno de los valores de gesture_phase_t */
+    uint8_t options : 2; /*!< Gestos opcionales que reconoce la tecla */
+}; /*!< Estado de una tecla en el reconocedor de gestos, ocupa seis bytes */
+
+struct digital_gestures_s {
+    digital_gestures_timing_t timing;                    /*!< Tiempos de los gestos */
+    struct gesture_key_s keys[DIGITAL_GESTURE_MAX_KEYS]; /*!< Estado de cada tecla */
+    uint8_t queue[DIGITAL_GESTURE_QUEUE][2];             /*!< Gestos pendientes, posición de la tecla y tipo de gesto */
+    uint8_t count;                                       /*!< Cantidad de teclas agregadas */
+    uint8_t head;                                        /*!< Posición del gesto más antiguo en la cola */
+    uint8_t pending;                                     /*!< Cantidad de gestos en la cola */
+}; /*!< Estructura que representa un reconocedor de gestos */
+
+// Verifica al compilar que la memoria declarada en digital.h alcance para las estructuras internas
+typedef char output_storage_check_t[(sizeof(struct digital_output_s) <= sizeof(digital_output_storage_t)) ? 1 : -1];
+typedef char input_storage_check_t[(sizeof(struct digital_input_s) <= sizeof(digital_input_storage_t)) ? 1 : -1];
+typedef char ogroup_check_t[(sizeof(struct digital_output_group_s) <= sizeof(digital_output_group_storage_t)) ? 1 : -1];
+typedef char group_check_t[(sizeof(struct digital_input_group_s) <= sizeof(digital_input_group_storage_t)) ? 1 : -1];
+typedef char gestures_check_t[(sizeof(struct digital_gestures_s) <= sizeof(digital_gestures_storage_t)) ? 1 : -1];
+
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Inicializa una salida en la memoria indicada, que puede venir de la reserva o de la aplicación.
+ */
+static digital_output_t OutputInit(digital_output_t self, uint8_t gpio, uint8_t bit, bool inverted);
+
+/**
+ * @brief Inicializa una entrada en la memoria indicada, que puede venir de la reserva o de la aplicación.
+ */
+static digital_input_t InputInit(digital_input_t self, uint8_t gpio, uint8_t bit, bool inverted);
+
+/**
+ * @brief Inicializa un grupo de salidas vacío en la memoria indicada, que puede venir de la reserva o de la aplicación.
+ */
+static digital_output_group_t OutputGroupInit(digital_output_group_t self);
+
+/**
+ * @brief Inicializa un grupo vacío en la memoria indicada, que puede venir de la reserva o de la aplicación.
+ */
+static digital_input_group_t GroupInit(digital_input_group_t self);
+
+/**
+ * @brief Filtra los rebotes de las entradas de un puerto con contadores verticales.
+ * @details Cada entrada cuenta las muestras seguidas en que su lectura difiere del estado aceptado, el contador vuelve
+ * a cero cuando coinciden y el estado cambia cuando llega a la cantidad de muestras configurada.
+ * @param count Planos de bits de los contadores del puerto, el plano k tiene el bit k del contador de cada entrada.
+ * @return Entradas del puerto cuyo estado aceptado cambia con esta muestra.
+ */
+static uint32_t GroupDebounce(uint32_t count[DIGITAL_DEBOUNCE_PLANES], uint32_t value, uint32_t state, uint8_t samples);
+
+/**
+ * @brief Devuelve la máscara de una entrada, con su posición de puerto en el grupo, sin verificar que esté agregada.
+ * @return La máscara, o 0 si el puerto de la entrada no está en el grupo.
+ */
+static digital_keys_t GroupKey(digital_input_group_t self, digital_input_t input);
+
+/**
+ * @brief Inicializa un reconocedor sin teclas en la memoria indicada, que puede venir de la reserva o de la aplicación.
+ */
+static digital_gestures_t GesturesInit(digital_gestures_t self, const digital_gestures_timing_t * timing);
+
+/**
+ * @brief Encola un gesto, o lo descarta si la cola está llena.
+ */
+static void GestureEmit(digital_gestures_t self, const struct gesture_key_s * key, digital_gesture_kind_t kind);
+
+/**
+ * @brief Avanza el reconocimiento de una tecla.
+ * @param elapsed Tiempo transcurrido desde la marca de la tecla.
+ */
+static void GestureStep(digital_gestures_t self, struct gesture_key_s * key, bool pressed, uint16_t now,
+                        uint16_t elapsed);
+
 /* === Private variable definitions ================================================================================ */
 
+static struct digital_output_s outputs[DIGITAL_MAX_OUTPUTS]; // Reserva de salidas que entrega DigitalOutputCreate
+static uint8_t outputs_used;                                 // Cantidad de salidas ya entregadas
+static struct digital_input_s inputs[DIGITAL_MAX_INPUTS];    // Reserva de entradas que entrega DigitalInputCreate
+static uint8_t inputs_used;                                  // Cantidad de entradas ya entregadas
+static struct digital_output_group_s output_groups[DIGITAL_MAX_OUTPUT_GROUPS]; // Reserva de DigitalOutputGroupCreate
+static uint8_t output_groups_used;                                            // Grupos de salidas ya entregados
+static struct digital_input_group_s groups[DIGITAL_MAX_GROUPS]; // Reserva de grupos que entrega DigitalInputGroupCreate
+static uint8_t groups_used;                                     // Cantidad de grupos ya entregados
+static struct digital_gestures_s gestures[DIGITAL_MAX_GESTURES]; // Reserva que entrega DigitalGesturesCreate
+static uint8_t gestures_used;                                    // Cantidad de reconocedores ya entregados
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
+static digital_output_t OutputInit(digital_output_t self, uint8_t gpio, uint8_t bit, bool inverted) {
+    self->gpio = gpio;
+    self->bit = bit;
+    self->inverted = inverted;
+
+    DigitalPinWrite(self->gpio, self->bit, self->inverted);
+    DigitalPinSetDirection(self->gpio, self->bit, true);
+    return self;
+}
+
+static digital_input_t InputInit(digital_input_t self, uint8_t gpio, uint8_t bit, bool inverted) {
+    self->gpio = gpio;
+    self->bit = bit;
+    self->inverted = inverted;
+
+    DigitalPinSetDirection(self->gpio, self->bit, false);
+
+    self->lastState = DigitalInputGetIsActive(self);
+    return self;
+}
+
+static digital_output_group_t OutputGroupInit(digital_output_group_t self) {
+    memset(self, 0, sizeof(struct digital_output_group_s));
+    return self;
+}
+
+static digital_input_group_t GroupInit(digital_input_group_t self) {
+    memset(self, 0, sizeof(struct digital_input_group_s));
+    self->samples = 1;
+    return self;
+}
+
+static uint32_t GroupDebounce(uint32_t count[DIGITAL_DEBOUNCE_PLANES], uint32_t value, uint32_t state,
+                              uint8_t samples) {
+    uint32_t differs = value ^ state;
+    uint32_t carry = differs;
+    uint32_t reached = differs;
+
+    // Suma uno a los contadores de las entradas que difieren y pone en cero los demás
+    for (uint8_t plane = 0; plane < DIGITAL_DEBOUNCE_PLANES; plane++) {
+        uint32_t bits = count[plane] & differs;
+        count[plane] = bits ^ carry;
+        carry = bits & carry;
+        reached &= (samples & (1U << plane)) ? count[plane] : ~count[plane];
+    }
+    // Las entradas que cambian de estado empiezan a contar de nuevo
+    for (uint8_t plane = 0; plane < DIGITAL_DEBOUNCE_PLANES; plane++) {
+        count[plane] &= ~reached;
+    }
+    return reached;
+}
+
+static digital_keys_t GroupKey(digital_input_group_t self, digital_input_t input) {
+    digital_keys_t key = 0;
+
+    for (uint8_t port = 0; port < self->ports; port++) {
+        if (self->gpio[port] == input->gpio) {
+            key = (digital_keys_t)(1UL << input->bit) << (32 * port);
+        }
+    }
+    return key;
+}
+
+static digital_gestures_t GesturesInit(digital_gestures_t self, const digital_gestures_timing_t * timing) {
+    memset(self, 0, sizeof(struct digital_gestures_s));
+    self->timing = *timing;
+    return self;
+}
+
+static void GestureEmit(digital_gestures_t self, const struct gesture_key_s * key, digital_gesture_kind_t kind) {
+    if (self->pending < DIGITAL_GESTURE_QUEUE) {
+        uint8_t tail = (self->head + self->pending) % DIGITAL_GESTURE_QUEUE;
+
+        self->queue[tail][0] = key->key;
+        self->queue[tail][1] = kind;
+        self->pending++;
+    }
+}
+
+static void GestureStep(digital_gestures_t self, struct gesture_key_s * key, bool pressed, uint16_t now,
+                        uint16_t elapsed) {
+    const digital_gestures_timing_t * timing = &self->timing;
+
+    switch (key->phase) {
+    case GESTURE_IDLE:
+        if (pressed) {
+            key->phase = GESTURE_DOWN;
+            key->mark = now;
+        }
+        break;
+
+    case GESTURE_DOWN:
+        if (!pressed && (key->options & DIGITAL_GESTURE_OPTION_DOUBLE)) {
+            key->phase = GESTURE_RELEASED;
+            key->mark = now;
+        } else if (!pressed) {
+            GestureEmit(self, key, DIGITAL_GESTURE_PRESS);
+            key->phase = GESTURE_IDLE;
+        } else if ((key->options & DIGITAL_GESTURE_OPTION_REPEAT) && (elapsed >= timing->repeat_delay)) {
+            GestureEmit(self, key, DIGITAL_GESTURE_REPEAT);
+            key->phase = GESTURE_REPEAT;
+            key->mark = now;
+            key->interval = timing->repeat_period;
+        } else if (!(key->options & DIGITAL_GESTURE_OPTION_REPEAT) && (elapsed >= timing->long_press)) {
+            GestureEmit(self, key, DIGITAL_GESTURE_LONG_PRESS);
+            key->phase = GESTURE_HELD;
+        }
+        break;
+
+    case GESTURE_REPEAT:
+        if (!pressed) {
+            key->phase = GESTURE_IDLE;
+        } else if (elapsed >= key->interval) {
+            // La marca avanza un intervalo para mantener el ritmo aunque la actualización llegue tarde
+            GestureEmit(self, key, DIGITAL_GESTURE_REPEAT);
+            key->mark += key->interval;
+            key->interval -= key->interval >> GESTURE_ACCELERATION;
+            if (key->interval < timing->repeat_min) {
+                key->interval = timing->repeat_min;
+            }
+        }
+        break;
+
+    case GESTURE_RELEASED:
+        if (pressed) {
+            GestureEmit(self, key, DIGITAL_GESTURE_DOUBLE_PRESS);
+            key->phase = GESTURE_HELD;
+        } else if (elapsed >= timing->double_press) {
+            GestureEmit(self, key, DIGITAL_GESTURE_PRESS);
+            key->phase = GESTURE_IDLE;
+        }
+        break;
+
+    default:
+        if (!pressed) {
+            key->phase = GESTURE_IDLE;
+        }
+        break;
+    }
+}
+
 /* === Public function implementation ============================================================================== */
 
 digital_output_t DigitalOutputCreate(uint8_t gpio, uint8_t bit, bool inverted) {
-    digital_output_t self = malloc(sizeof(struct digital_output_s));
-    if (self != NULL) {
-        self->gpio = gpio;
-        self->bit = bit;
-        self->inverted = inverted;
+    digital_output_t self = NULL;
+    if (outputs_used < DIGITAL_MAX_OUTPUTS) {
+        self = OutputInit(&outputs[outputs_used++], gpio, bit, inverted);
+    }
+    return self;
+}
 
-        Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->gpio, self->bit, self->inverted);
-        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->gpio, self->bit, true);
+digital_output_t DigitalOutputCreateStatic(digital_output_storage_t * storage, uint8_t gpio, uint8_t bit,
+                                           bool inverted) {
+    digital_output_t self = NULL;
+    if (storage != NULL) {
+        self = OutputInit((digital_output_t)storage, gpio, bit, inverted);
     }
     return self;
 }
 
 void DigitalOutputActivate(digital_output_t self) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->gpio, self->bit, self->inverted);
+    DigitalPinWrite(self->gpio, self->bit, self->inverted);
 }
 
 void DigitalOutputDeactivate(digital_output_t self) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->gpio, self->bit, !self->inverted);
+    DigitalPinWrite(self->gpio, self->bit, !self->inverted);
 }
 
 void DigitalOutputToggle(digital_output_t self) {
-    Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, self->gpio, self->bit);
+    DigitalPinToggle(self->gpio, self->bit);
 }
 
-digital_input_t DigitalInputCreate(uint8_t gpio, uint8_t bit, bool inverted) {
-    digital_input_t self = malloc(sizeof(struct digital_input_s));
-    if (self != NULL) {
-        self->gpio = gpio;
-        self->bit = bit;
-        self->inverted = inverted;
+digital_output_group_t DigitalOutputGroupCreate(void) {
+    digital_output_group_t self = NULL;
+    if (output_groups_used < DIGITAL_MAX_OUTPUT_GROUPS) {
+        self = OutputGroupInit(&output_groups[output_groups_used++]);
+    }
+    return self;
+}
+
+digital_output_group_t DigitalOutputGroupCreateStatic(digital_output_group_storage_t * storage) {
+    digital_output_group_t self = NULL;
+    if (storage != NULL) {
+        self = OutputGroupInit((digital_output_group_t)storage);
+    }
+    return self;
+}
 
-        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->gpio, self->bit, false);
+digital_outputs_t DigitalOutputGroupAdd(digital_output_group_t self, digital_output_t output) {
+    digital_outputs_t result = 0;
+    uint8_t slot = 0;
 
-        self->lastState = DigitalInputGetIsActive(self);
+    while ((slot < self->ports) && (self->gpio[slot] != output->gpio)) {
+        slot++;
+    }
+    if ((self->count < DIGITAL_OUTPUT_GROUP_MAX_OUTPUTS) && (slot < DIGITAL_OUTPUT_GROUP_MAX_PORTS)) {
+        if (slot == self->ports) {
+            self->gpio[self->ports++] = output->gpio;
+        }
+        result = 1 << self->count;
+        self->pins[self->count] = 1UL << output->bit;
+        self->slot[self->count] = slot;
+        self->count++;
+        // Misma polaridad que DigitalOutputActivate, que pone el terminal en el nivel de inverted
+        if (!output->inverted) {
+            self->high |= result;
+        }
+    }
+    return result;
+}
+
+void DigitalOutputGroupWrite(digital_output_group_t self, digital_outputs_t outputs, digital_outputs_t active) {
+    uint32_t set[DIGITAL_OUTPUT_GROUP_MAX_PORTS] = {0};
+    uint32_t clear[DIGITAL_OUTPUT_GROUP_MAX_PORTS] = {0};
+    digital_outputs_t level = active ^ self->high; // Nivel de cada terminal con la polaridad ya aplicada
+
+    for (uint8_t index = 0; index < self->count; index++) {
+        if (outputs & (1 << index)) {
+            if (level & (1 << index)) {
+                set[self->slot[index]] |= self->pins[index];
+            } else {
+                clear[self->slot[index]] |= self->pins[index];
+            }
+        }
+    }
+    for (uint8_t slot = 0; slot < self->ports; slot++) {
+        if (set[slot]) {
+            DigitalPortSet(self->gpio[slot], set[slot]);
+        }
+        if (clear[slot]) {
+            DigitalPortClear(self->gpio[slot], clear[slot]);
+        }
+    }
+}
+
+digital_input_t DigitalInputCreate(uint8_t gpio, uint8_t bit, bool inverted) {
+    digital_input_t self = NULL;
+    if (inputs_used < DIGITAL_MAX_INPUTS) {
+        self = InputInit(&inputs[inputs_used++], gpio, bit, inverted);
+    }
+    return self;
+}
+
+digital_input_t DigitalInputCreateStatic(digital_input_storage_t * storage, uint8_t gpio, uint8_t bit, bool inverted) {
+    digital_input_t self = NULL;
+    if (storage != NULL) {
+        self = InputInit((digital_input_t)storage, gpio, bit, inverted);
     }
     return self;
 }
 
 bool DigitalInputGetIsActive(digital_input_t self) {
-    bool state = Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, self->gpio, self->bit) != 0;
+    bool state = DigitalPinRead(self->gpio, self->bit);
     if (self->inverted) {
         state = !state;
     }
@@ -126,4 +455,175 @@ bool DigitalInputWasDeactivated(digital_input_t self) {
     return DIGITAL_INPUT_WAS_DEACTIVATED == DigitalInputWasChanged(self);
 }
 
+digital_input_group_t DigitalInputGroupCreate(void) {
+    digital_input_group_t self = NULL;
+    if (groups_used < DIGITAL_MAX_GROUPS) {
+        self = GroupInit(&groups[groups_used++]);
+    }
+    return self;
+}
+
+digital_input_group_t DigitalInputGroupCreateStatic(digital_input_group_storage_t * storage) {
+    digital_input_group_t self = NULL;
+    if (storage != NULL) {
+        self = GroupInit((digital_input_group_t)storage);
+    }
+    return self;
+}
+
+digital_keys_t DigitalInputGroupAdd(digital_input_group_t self, digital_input_t input) {
+    digital_keys_t key = GroupKey(self, input);
+
+    if ((key == 0) && (self->ports < DIGITAL_GROUP_MAX_PORTS)) {
+        self->gpio[self->ports++] = input->gpio;
+        key = GroupKey(self, input);
+    }
+    if (key != 0) {
+        uint8_t port = (key >> 32) ? 1 : 0;
+
+        self->mask[port] |= 1UL << input->bit;
+        if (input->inverted) {
+            self->invert[port] |= 1UL << input->bit;
+        } else {
+            self->invert[port] &= ~(1UL << input->bit);
+        }
+        if (DigitalInputGetIsActive(input)) {
+            self->state |= key;
+        }
+    }
+    return key;
+}
+
+bool DigitalInputGroupSetDebounce(digital_input_group_t self, uint8_t samples) {
+    bool result = false;
+
+    if ((samples > 0) && (samples <= DIGITAL_DEBOUNCE_MAX_SAMPLES)) {
+        self->samples = samples;
+        result = true;
+    }
+    return result;
+}
+
+digital_keys_t DigitalInputGroupKey(digital_input_group_t self, digital_input_t input) {
+    digital_keys_t key = GroupKey(self, input);
+    uint8_t port = (key >> 32) ? 1 : 0;
+
+    if ((self->mask[port] & (1UL << input->bit)) == 0) {
+        key = 0;
+    }
+    return key;
+}
+
+void DigitalInputGroupScan(digital_input_group_t self) {
+    digital_keys_t changed = 0;
+    digital_keys_t state;
+
+    // Un acceso por puerto, las entradas invertidas se corrigen con un XOR y las ajenas al grupo se descartan
+    for (uint8_t port = 0; port < self->ports; port++) {
+        uint32_t value = (DigitalPortRead(self->gpio[port]) ^ self->invert[port]) & self->mask[port];
+        uint32_t accepted = (uint32_t)(self->state >> (32 * port));
+        changed |= (digital_keys_t)GroupDebounce(self->count[port], value, accepted, self->samples) << (32 * port);
+    }
+    state = self->state ^ changed;
+    self->activated = changed & state;
+    self->deactivated = changed & ~state;
+    self->state = state;
+}
+
+bool DigitalInputGroupIsSettled(digital_input_group_t self) {
+    uint32_t pending = 0;
+
+    for (uint8_t port = 0; port < self->ports; port++) {
+        uint32_t value = (DigitalPortRead(self->gpio[port]) ^ self->invert[port]) & self->mask[port];
+        pending |= value ^ (uint32_t)(self->state >> (32 * port));
+        for (uint8_t plane = 0; plane < DIGITAL_DEBOUNCE_PLANES; plane++) {
+            pending |= self->count[port][plane];
+        }
+    }
+    return (pending == 0);
+}
+
+digital_keys_t DigitalInputGroupActive(digital_input_group_t self) {
+    return self->state;
+}
+
+digital_keys_t DigitalInputGroupActivated(digital_input_group_t self) {
+    return self->activated;
+}
+
+digital_keys_t DigitalInputGroupDeactivated(digital_input_group_t self) {
+    return self->deactivated;
+}
+
+void DigitalInputGroupConsume(digital_input_group_t self, digital_keys_t keys) {
+    self->activated &= ~keys;
+    self->deactivated &= ~keys;
+}
+
+digital_gestures_t DigitalGesturesCreate(const digital_gestures_timing_t * timing) {
+    digital_gestures_t self = NULL;
+    if (gestures_used < DIGITAL_MAX_GESTURES) {
+        self = GesturesInit(&gestures[gestures_used++], timing);
+    }
+    return self;
+}
+
+digital_gestures_t DigitalGesturesCreateStatic(digital_gestures_storage_t * storage,
+                                               const digital_gestures_timing_t * timing) {
+    digital_gestures_t self = NULL;
+    if (storage != NULL) {
+        self = GesturesInit((digital_gestures_t)storage, timing);
+    }
+    return self;
+}
+
+bool DigitalGesturesAdd(digital_gestures_t self, digital_keys_t key, uint8_t options) {
+    bool result = false;
+
+    if ((key != 0) && (self->count < DIGITAL_GESTURE_MAX_KEYS)) {
+        struct gesture_key_s * entry = &self->keys[self->count++];
+
+        // Se guarda la posición del bit en lugar de la máscara para que cada tecla ocupe pocos bytes
+        for (entry->key = 0; (key & 1) == 0; entry->key++) {
+            key >>= 1;
+        }
+        entry->options = options & (DIGITAL_GESTURE_OPTION_DOUBLE | DIGITAL_GESTURE_OPTION_REPEAT);
+        result = true;
+    }
+    return result;
+}
+
+void DigitalGesturesUpdate(digital_gestures_t self, digital_keys_t pressed, uint32_t now) {
+    for (uint8_t index = 0; index < self->count; index++) {
+        struct gesture_key_s * key = &self->keys[index];
+        uint16_t elapsed = (uint16_t)now - key->mark;
+
+        GestureStep(self, key, (pressed >> key->key) & 1, (uint16_t)now, elapsed);
+    }
+}
+
+bool DigitalGesturesNext(digital_gestures_t self, digital_gesture_t * gesture) {
+    bool result = false;
+
+    if (self->pending > 0) {
+        gesture->key = (digital_keys_t)1 << self->queue[self->head][0];
+        gesture->kind = (digital_gesture_kind_t)self->queue[self->head][1];
+        self->head = (self->head + 1) % DIGITAL_GESTURE_QUEUE;
+        self->pending--;
+        result = true;
+    }
+    return result;
+}
+
+bool DigitalGesturesIsIdle(digital_gestures_t self) {
+    bool result = true;
+
+    for (uint8_t index = 0; index < self->count; index++) {
+        if ((self->keys[index].phase != GESTURE_IDLE) && (self->keys[index].phase != GESTURE_HELD)) {
+            result = false;
+        }
+    }
+    return result;
+}
+
 /* === End of documentation ======================================================================================== */
@@ -19,10 +19,10 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions ==================================================================================== */
 
-#include "chip.h"
 #include "FreeRTOS.h"
 #include "task.h"
 #include "semphr.h"
+#include "queue.h"
 
 #include "digital.h"
 #include "config.h"
@@ -30,394 +30,213 @@ SPDX-License-Identifier: MIT
 #include "screen.h"
 #include "poncho.h"
 #include "clock.h"
+#include "ui.h"
 
 /* === Macros definitions ========================================================================================== */
-#define LONG_PRESS_TIME_MS    3000
-#define DEBOUNCE_TOLERANCE_MS 100
+#define LONG_PRESS_TIME_MS    3000 // Presión larga que entra a los modos de configuración
+#define DOUBLE_PRESS_TIME_MS  300  // Ventana de la doble presión, ninguna tecla la usa por ahora
+#define REPEAT_DELAY_MS       500  // Tiempo mantenido hasta que incrementar o decrementar empiezan a repetir
+#define REPEAT_PERIOD_MS      200  // Intervalo de las primeras repeticiones
+#define REPEAT_MIN_PERIOD_MS  25   // Intervalo de las repeticiones ya aceleradas
 
-/* === Private data type declarations ============================================================================== */
+#define KEY_SAMPLE_PERIOD_MS 5 // Período de muestreo de las teclas
+#define KEY_DEBOUNCE_SAMPLES 4 // Muestras iguales que necesita una tecla para cambiar, 20 ms en total
+
+#define KEY_EVENT (1UL << 31) // Notificación de un flanco en las teclas
+
+#define UI_EVENTS_LENGTH   8     // Eventos que pueden esperar en la cola de la interfaz
+#define UI_EDIT_TIMEOUT_MS 30000 // Tiempo sin usar las teclas que cancela la edición
+#define UI_CLOCK_WAIT_MS   50    // Espera máxima de ClockTask por lugar en la cola de la interfaz
 
-typedef struct {
-    TickType_t press_time;
-    TickType_t release_time;
-    bool active;
-} long_press_t;
+// Tiempo que queda encendido cada dígito, con cuatro dígitos da 64 barridos por segundo y los tiempos de parpadeo, que
+// cuentan barridos completos en potencias de 2, resultan en fracciones exactas de segundo
+#define DISPLAY_SLOT_TIME_US 3906
+
+/* === Private data type declarations ============================================================================== */
 
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Traduce un gesto de las teclas al evento de la interfaz que produce, o UI_EVENT_NONE si no produce ninguno.
+ */
+static ui_event_t GestureEvent(const digital_gesture_t * gesture);
+
+/**
+ * @brief Indica si el gesto lo hizo la tecla indicada.
+ */
+static bool GestureKey(const digital_gesture_t * gesture, digital_input_t key);
+
 /* === Private variable definitions ================================================================================ */
-system_mode_t mode = MODE_UNSET;
 Board_t board;
 clock_t clock;
-clock_time_t current_time;
-clock_time_t alarm_time;
-
-uint8_t digits[4] = {0, 0, 0, 0};
-uint8_t dots[4] = {0, 1, 0, 0};
-uint8_t last_state;
-
-volatile bool timeout = false;
-volatile uint8_t timeout_counter = 0;
+ui_t ui;
+TaskHandle_t button_task;
+QueueHandle_t ui_events; // Eventos de las teclas y del reloj, en el orden en que ocurren
+
+digital_gestures_t gestures;
+
+static const digital_gestures_timing_t gestures_timing = {
+    .long_press = pdMS_TO_TICKS(LONG_PRESS_TIME_MS),
+    .double_press = pdMS_TO_TICKS(DOUBLE_PRESS_TIME_MS),
+    .repeat_delay = pdMS_TO_TICKS(REPEAT_DELAY_MS),
+    .repeat_period = pdMS_TO_TICKS(REPEAT_PERIOD_MS),
+    .repeat_min = pdMS_TO_TICKS(REPEAT_MIN_PERIOD_MS),
+};
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
-/* === Private function declarations =============================================================================== */
-void LongPressInit(long_press_t * lp) {
-    lp->press_time = 0;
-    lp->release_time = 0;
-    lp->active = false;
-}
+static ui_event_t GestureEvent(const digital_gesture_t * gesture) {
+    ui_event_t result = UI_EVENT_NONE;
+    bool step = (gesture->kind == DIGITAL_GESTURE_PRESS) || (gesture->kind == DIGITAL_GESTURE_REPEAT);
 
-bool LongPressUpdate(long_press_t * lp, bool is_pressed, TickType_t current_time, TickType_t press_threshold,
-                     TickType_t release_tolerance) {
-    if (is_pressed) {
-        lp->release_time = 0;
-        if (lp->press_time == 0) {
-            lp->press_time = current_time;
-        } else if (!lp->active && (current_time - lp->press_time >= press_threshold)) {
-            lp->active = true;
-            return true; // Se activó por presión larga
+    if (gesture->kind == DIGITAL_GESTURE_LONG_PRESS) {
+        if (GestureKey(gesture, board->set_time)) {
+            result = UI_EVENT_SET_TIME;
+        } else if (GestureKey(gesture, board->set_alarm)) {
+            result = UI_EVENT_SET_ALARM;
         }
-    } else {
-        if (lp->press_time > 0) {
-            if (lp->release_time == 0) {
-                lp->release_time = current_time;
-            } else if (current_time - lp->release_time >= release_tolerance) {
-                lp->press_time = 0;
-                lp->release_time = 0;
-                lp->active = false;
-            }
+    } else if (step && GestureKey(gesture, board->increment)) {
+        result = UI_EVENT_INCREMENT;
+    } else if (step && GestureKey(gesture, board->decrement)) {
+        result = UI_EVENT_DECREMENT;
+    } else if (gesture->kind == DIGITAL_GESTURE_PRESS) {
+        if (GestureKey(gesture, board->accept)) {
+            result = UI_EVENT_ACCEPT;
+        } else if (GestureKey(gesture, board->cancel)) {
+            result = UI_EVENT_CANCEL;
         }
     }
+    return result;
+}
 
-    return false;
+static bool GestureKey(const digital_gesture_t * gesture, digital_input_t key) {
+    return (gesture->key & DigitalInputGroupKey(board->keys, key)) != 0;
 }
 
-void digitsToTime(uint8_t * digits, clock_time_t * time) {
-    time->bcd[5] = digits[0];
-    time->bcd[4] = digits[1];
-    time->bcd[3] = digits[2];
-    time->bcd[2] = digits[3];
-    time->bcd[1] = 0;
-    time->bcd[0] = 0;
+uint32_t ClockGetTicks(void) {
+    return xTaskGetTickCount();
 }
 
-void timeToDigits(uint8_t * digits, clock_time_t * time) {
-    digits[0] = time->bcd[5];
-    digits[1] = time->bcd[4];
-    digits[2] = time->bcd[3];
-    digits[3] = time->bcd[2];
+// Las escrituras del reloj no se interrumpen, asi una tarea de mayor prioridad nunca espera a que terminen
+void ClockCriticalEnter(void) {
+    vTaskSuspendAll();
 }
 
-uint32_t ClockGetTicks(void) {
-    return xTaskGetTickCount();
+void ClockCriticalExit(void) {
+    (void)xTaskResumeAll();
 }
 
+#ifdef DISPLAY_REFRESH_TASK
+// Multiplexado desde una tarea, el tiempo de cada dígito depende de la carga del sistema
 void DisplayTask(void * pvParameters) {
 
     while (true) {
-        ScreenWriteBCD(board->screen, digits, sizeof(digits));
-        ScreenWriteDOT(board->screen, dots, sizeof(dots));
-        ScreenRefresh(board->screen); // Multiplexa solo
-        vTaskDelay(pdMS_TO_TICKS(5)); // Refresca a 5 ms
+        // Los dígitos los escribe UiTask, esta tarea solo multiplexa el último cuadro completo
+        ScreenRefresh(board->screen);                                   // Multiplexa solo
+        vTaskDelay(pdMS_TO_TICKS((DISPLAY_SLOT_TIME_US + 500) / 1000)); // Refresca cada 4 ms, redondeado al ms
     }
 }
-
-void ClockTask(void * pvParameters) {
-    TickType_t lastWakeTime = xTaskGetTickCount();
-    while (true) {
-        ClockNewTick(clock);
-        ClockGetTime(clock, &current_time);
-        vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(1));
+#endif
+
+// Encola los eventos del minuto y de la alarma para la interfaz, se llama desde ClockTask fuera de las escrituras del
+// reloj. Si la cola sigue llena, por ejemplo con la repetición de una tecla, el evento se descarta para no demorar el
+// reloj: la interfaz atiende una alarma perdida con el próximo cambio de minuto
+void ClockEventHandler(clock_t clock, uint8_t events, void * object) {
+    ui_event_t event;
+
+    (void)clock;
+    if (events & CLOCK_EVENT_ALARM) {
+        event = UI_EVENT_ALARM;
+        xQueueSend((QueueHandle_t)object, &event, pdMS_TO_TICKS(UI_CLOCK_WAIT_MS));
+    }
+    if (events & CLOCK_EVENT_MINUTE) {
+        event = UI_EVENT_MINUTE;
+        xQueueSend((QueueHandle_t)object, &event, pdMS_TO_TICKS(UI_CLOCK_WAIT_MS));
     }
 }
 
-void ButtonTask(void * pvParameters) {
-    static long_press_t set_alarm_lp;
-    LongPressInit(&set_alarm_lp);
+// Despierta a la tarea de botones con el primer flanco de una tecla, se llama desde la interrupción
+void KeyEventHandler(void * object) {
+    BaseType_t woken = pdFALSE;
 
-    static long_press_t set_time_lp;
-    LongPressInit(&set_time_lp);
+    xTaskNotifyFromISR((TaskHandle_t)object, KEY_EVENT, eSetBits, &woken);
+    portYIELD_FROM_ISR(woken);
+}
 
+void ClockTask(void * pvParameters) {
+    TickType_t lastAdvance = xTaskGetTickCount();
     while (true) {
-        switch (mode) {
-        case MODE_UNSET:
-            if (LongPressUpdate(&set_alarm_lp, !DigitalInputGetIsActive(board->set_alarm), xTaskGetTickCount(),
-                                pdMS_TO_TICKS(LONG_PRESS_TIME_MS), pdMS_TO_TICKS(DEBOUNCE_TOLERANCE_MS))) {
-
-                if (ClockGetAlarmTime(clock, &alarm_time)) {
-                    timeToDigits(digits, &alarm_time);
-                }
-                mode = MODE_SET_ALARM_MINUTES;
-                last_state = MODE_UNSET;
-                DisplayFlashDigits(board->screen, 2, 3, 10);
-
-            } else if (LongPressUpdate(&set_time_lp, !DigitalInputGetIsActive(board->set_time), xTaskGetTickCount(),
-                                       pdMS_TO_TICKS(LONG_PRESS_TIME_MS), pdMS_TO_TICKS(DEBOUNCE_TOLERANCE_MS))) {
-                mode = MODE_SET_TIME_MINUTES;
-                last_state = MODE_UNSET;
-                DisplayFlashDigits(board->screen, 2, 3, 10);
-            }
-            break;
-
-        case MODE_HOME:
-
-            if (ClockGetTime(clock, &current_time)) {
-                timeToDigits(digits, &current_time); // Actualizar los dígitos con la hora actual
-            }
-
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
-
-            if (LongPressUpdate(&set_time_lp, !DigitalInputGetIsActive(board->set_time), xTaskGetTickCount(),
-                                pdMS_TO_TICKS(LONG_PRESS_TIME_MS), pdMS_TO_TICKS(DEBOUNCE_TOLERANCE_MS))) {
-                mode = MODE_SET_TIME_MINUTES;
-                last_state = MODE_HOME;
-                DisplayFlashDigits(board->screen, 2, 3, 10);
-            } else if (LongPressUpdate(&set_alarm_lp, !DigitalInputGetIsActive(board->set_alarm), xTaskGetTickCount(),
-                                       pdMS_TO_TICKS(LONG_PRESS_TIME_MS), pdMS_TO_TICKS(DEBOUNCE_TOLERANCE_MS))) {
-
-                if (ClockGetAlarmTime(clock, &alarm_time)) {
-                    timeToDigits(digits, &alarm_time); // Convierte la hora de la alarma a dígitos
-                }
-                mode = MODE_SET_ALARM_MINUTES;
-                last_state = MODE_HOME;
-                DisplayFlashDigits(board->screen, 2, 3, 10);
-            } else if (ClockIsAlarmTriggered(clock)) {
-                mode = MODE_ALARM_TRIGGERED;
-                dots[3] = 1; // Indica que la alarma ha sido activada
-                DigitalOutputDeactivate(board->led_blue);
-
-            } else if (DigitalInputWasDeactivated(board->accept)) {
-                ClockEnableAlarm(clock);
-                dots[3] = 1; // Indica que la alarma está habilitada
-            } else if (DigitalInputWasDeactivated(board->cancel)) {
-                ClockDisableAlarm(clock);
-                dots[3] = 0; // Indica que la alarma no está habilitada
-            }
-
-            break;
-
-        case MODE_SET_TIME_MINUTES:
-
-            if (DigitalInputWasDeactivated(board->cancel) || timeout) {
-                if (last_state == MODE_UNSET) {
-                    DisplayFlashDigits(board->screen, 0, 3, 10);
-                    mode = MODE_UNSET; // Cancelar y volver al modo UNSET
-                } else {
-                    DisplayFlashDigits(board->screen, 0, 0, 0);
-                    mode = MODE_HOME; // Cancelar y volver al modo HOME
-                }
-                timeout = false;
-                timeout_counter = 0;
-            }
-            if (DigitalInputWasDeactivated(board->increment)) {
-                timeout = false;     // Reiniciar el timeout
-                timeout_counter = 0; // Reiniciar el contador
-
-                uint8_t min = (digits[2] * 10 + digits[3] + 1) % 60;
-                digits[2] = min / 10;
-                digits[3] = min % 10;
-            }
-            if (DigitalInputWasDeactivated(board->decrement)) {
-                timeout = false;     // Reiniciar el timeout
-                timeout_counter = 0; // Reiniciar el contador
-
-                uint8_t min = (digits[2] * 10 + digits[3] - 1 + 60) % 60;
-                digits[2] = min / 10;
-                digits[3] = min % 10;
-            }
-            if (DigitalInputWasDeactivated(board->accept)) {
-                timeout = false;     // Reiniciar el timeout
-                timeout_counter = 0; // Reiniciar el contador
-
-                mode = MODE_SET_TIME_HOURS;
-                DisplayFlashDigits(board->screen, 0, 1, 10);
-            }
-
-            break;
-
-        case MODE_SET_TIME_HOURS:
-            if (DigitalInputWasDeactivated(board->cancel) || timeout) {
-                if (last_state == MODE_UNSET) {
-                    DisplayFlashDigits(board->screen, 0, 3, 10);
-                    mode = MODE_UNSET; // Cancelar y volver al modo UNSET
-                } else {
-                    DisplayFlashDigits(board->screen, 0, 0, 0);
-                    mode = MODE_HOME; // Cancelar y volver al modo HOME
-                }
-                timeout = false;
-                timeout_counter = 0;
-            }
-            if (DigitalInputWasDeactivated(board->increment)) {
-                timeout = false;     // Reiniciar el timeout
-                timeout_counter = 0; // Reiniciar el contador
+        // Se duerme hasta el proximo segundo o vencimiento de alarma en lugar de despertarse en cada tick
+        vTaskDelay(ClockTicksUntilNextEvent(clock, CLOCK_EVENT_SECOND | CLOCK_EVENT_ALARM));
 
-                uint8_t horas = (digits[0] * 10 + digits[1] + 1) % 24;
-                digits[0] = horas / 10;
-                digits[1] = horas % 10;
-            }
-            if (DigitalInputWasDeactivated(board->decrement)) {
-                timeout = false;     // Reiniciar el timeout
-                timeout_counter = 0; // Reiniciar el contador
-
-                uint8_t horas = (digits[0] * 10 + digits[1] - 1 + 24) % 24;
-                digits[0] = horas / 10;
-                digits[1] = horas % 10;
-            }
-            if (DigitalInputWasDeactivated(board->accept)) {
-
-                DisplayFlashDigits(board->screen, 0, 0, 0);
-                digitsToTime(digits, &current_time); // Convierte los dígitos a tiempo actual
-                if (ClockSetTime(clock, &current_time)) {
-                    mode = MODE_HOME; // Vuelve al modo HOME después de aceptar
-                    last_state = MODE_HOME;
-                }
-            }
-
-            break;
-
-        case MODE_SET_ALARM_MINUTES:
-            if (DigitalInputWasDeactivated(board->cancel) || timeout) {
-                if (last_state == MODE_UNSET) {
-                    DisplayFlashDigits(board->screen, 0, 3, 10);
-                    mode = MODE_UNSET; // Cancelar y volver al modo UNSET
-                } else {
-                    DisplayFlashDigits(board->screen, 0, 0, 0);
-                    mode = MODE_HOME; // Cancelar y volver al modo HOME
-                }
-                timeout = false;
-                timeout_counter = 0;
-            }
-
-            if (DigitalInputWasDeactivated(board->increment)) {
-                timeout = false; // Reiniciar el timeout
-
-                uint8_t min = (digits[2] * 10 + digits[3] + 1) % 60;
-                digits[2] = min / 10;
-                digits[3] = min % 10;
-            }
-            if (DigitalInputWasDeactivated(board->decrement)) {
-                timeout = false; // Reiniciar el timeout
-
-                uint8_t min = (digits[2] * 10 + digits[3] - 1 + 60) % 60;
-                digits[2] = min / 10;
-                digits[3] = min % 10;
-            }
-            if (DigitalInputWasDeactivated(board->accept)) {
-                timeout = false;     // Reiniciar el timeout
-                timeout_counter = 0; // Reiniciar el contador
-
-                mode = MODE_SET_ALARM_HOURS;
-                DisplayFlashDigits(board->screen, 0, 1, 10);
-            }
-
-            break;
-
-        case MODE_SET_ALARM_HOURS:
-
-            if (DigitalInputWasDeactivated(board->cancel) || timeout) {
-                if (last_state == MODE_UNSET) {
-                    DisplayFlashDigits(board->screen, 0, 3, 10);
-                    mode = MODE_UNSET; // Cancelar y volver al modo UNSET
-                } else {
-                    DisplayFlashDigits(board->screen, 0, 0, 0);
-                    mode = MODE_HOME; // Cancelar y volver al modo HOME
-                }
-                timeout = false;
-                timeout_counter = 0;
-            }
-
-            if (DigitalInputWasDeactivated(board->increment)) {
-                timeout = false;     // Reiniciar el timeout
-                timeout_counter = 0; // Reiniciar el contador
-
-                uint8_t hora = (digits[0] * 10 + digits[1] + 1) % 24;
-                digits[0] = hora / 10;
-                digits[1] = hora % 10;
-            }
-            if (DigitalInputWasDeactivated(board->decrement)) {
-                timeout = false;     // Reiniciar el timeout
-                timeout_counter = 0; // Reiniciar el contador
-
-                uint8_t hora = (digits[0] * 10 + digits[1] - 1 + 24) % 24;
-                digits[0] = hora / 10;
-                digits[1] = hora % 10;
-            }
-            if (DigitalInputWasDeactivated(board->accept)) {
-
-                digitsToTime(digits, &alarm_time); // Convierte los dígitos a tiempo de alarma
-                if (ClockSetAlarmTime(clock, &alarm_time)) {
-                    dots[3] = 1; // Indica que la alarma está habilitada
-                    DisplayFlashDigits(board->screen, 0, 0, 0);
-                    ClockEnableAlarm(clock); // Habilita la alarma
-                    if (last_state != MODE_UNSET) {
-                        mode = MODE_HOME;
-                    } else {
-                        mode = MODE_UNSET;
-                        DisplayFlashDigits(board->screen, 0, 3, 10);
-                        digits[0] = 0;
-                        digits[1] = 0;
-                        digits[2] = 0;
-                        digits[3] = 0; // Reinicia los dígitos
-                    }
-                }
-            }
+        // Si la tarea se demoró se avanzan de una vez todos los ticks transcurridos
+        TickType_t now = xTaskGetTickCount();
+        ClockAdvanceTicks(clock, now - lastAdvance);
+        lastAdvance = now;
+    }
+}
 
-            break;
+void ButtonTask(void * pvParameters) {
+    TickType_t wait;
+    TickType_t last_sample = xTaskGetTickCount();
+    digital_gesture_t gesture;
+    ui_event_t event;
 
-        case MODE_ALARM_TRIGGERED:
+    while (true) {
+        // Una sola lectura por puerto para todas las teclas, los flancos valen hasta la próxima pasada. Si la tarea se
+        // despierta antes del período no se muestrea, para no acortar el antirrebote. Al despertar por un flanco
+        // después de estar quieta la primera muestra se toma enseguida
+        if (xTaskGetTickCount() - last_sample >= pdMS_TO_TICKS(KEY_SAMPLE_PERIOD_MS)) {
+            last_sample = xTaskGetTickCount();
+            DigitalInputGroupScan(board->keys);
+        } else {
+            DigitalInputGroupConsume(board->keys, ~(digital_keys_t)0);
+        }
 
-            if (DigitalInputWasDeactivated(board->cancel)) {
-                ClockCancelAlarmUntilNextDay(clock);
-                mode = MODE_HOME;
-                DigitalOutputActivate(board->led_blue);
-            } else if (DigitalInputWasDeactivated(board->accept)) {
-                ClockSnoozeAlarm(clock, 5);
-                mode = MODE_HOME;
-                DigitalOutputActivate(board->led_blue);
+        // Las teclas de la placa se leen activas mientras están sueltas, los gestos se reconocen sobre las inactivas
+        DigitalGesturesUpdate(gestures, ~DigitalInputGroupActive(board->keys), xTaskGetTickCount());
+        while (DigitalGesturesNext(gestures, &gesture)) {
+            event = GestureEvent(&gesture);
+            if (event != UI_EVENT_NONE) {
+                xQueueSend(ui_events, &event, 0);
             }
+        }
 
-            // No quiero que se quede parado en el modo de alarma, así que actualizo la hora
-
-            if (ClockGetTime(clock, &current_time)) {
-                timeToDigits(digits, &current_time); // Actualizar los dígitos con la hora actual
+        // Mientras una tecla cambia o un gesto depende del tiempo se muestrea con el período del antirrebote. Con todo
+        // quieto se duerme sin límite hasta un flanco. Las interrupciones se habilitan antes de la última lectura para
+        // no perder un cambio ocurrido entre la lectura y la espera. Si la placa no avisa los flancos, como la
+        // emulada, las teclas se siguen muestreando
+        wait = pdMS_TO_TICKS(KEY_SAMPLE_PERIOD_MS);
+        if (DigitalGesturesIsIdle(gestures) && DigitalInputGroupIsSettled(board->keys)) {
+            if (KeyEventsEnable() && DigitalInputGroupIsSettled(board->keys)) {
+                wait = portMAX_DELAY;
             }
-
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
-            break;
         }
-
-        vTaskDelay(pdMS_TO_TICKS(10));
+        xTaskNotifyWait(0, UINT32_MAX, NULL, wait);
     }
 }
 
-void DotBlinkTask(void * pvParameters) {
-    (void)pvParameters;
-
-    while (1) {
+void UiTask(void * pvParameters) {
+    TickType_t last_key = xTaskGetTickCount();
+    TickType_t elapsed;
+    TickType_t wait;
+    ui_event_t event;
 
-        if (mode == MODE_HOME || mode == MODE_ALARM_TRIGGERED) {
-            dots[1] = !dots[1]; // Esto se ve reflejado directamente
+    while (true) {
+        // Un evento por vez. Mientras se edita la espera termina cuando vence el tiempo desde la última tecla
+        wait = portMAX_DELAY;
+        if (UiIsEditing(ui)) {
+            elapsed = xTaskGetTickCount() - last_key;
+            wait = (elapsed < pdMS_TO_TICKS(UI_EDIT_TIMEOUT_MS)) ? pdMS_TO_TICKS(UI_EDIT_TIMEOUT_MS) - elapsed : 0;
         }
-        vTaskDelay(pdMS_TO_TICKS(1000)); // Esperar 1 segundo
-    }
-}
-
-void TimeOutTask(void * pvParameters) {
-    (void)pvParameters;
-
-    while (1) {
-
-        if (mode == MODE_SET_ALARM_HOURS || mode == MODE_SET_ALARM_MINUTES || mode == MODE_SET_TIME_HOURS ||
-            mode == MODE_SET_TIME_MINUTES) {
-            timeout_counter++;
-            if (timeout_counter >= 30) { // 30 segundos de inactividad
-                timeout = true;
-                timeout_counter = 0; // Reiniciar el contador
-            }
+        if (xQueueReceive(ui_events, &event, wait) != pdTRUE) {
+            event = UI_EVENT_TIMEOUT;
+        }
+        if (event <= UI_EVENT_CANCEL) {
+            last_key = xTaskGetTickCount();
         }
-        vTaskDelay(pdMS_TO_TICKS(1000)); // Esperar 1 segundo
+        UiHandleEvent(ui, event);
     }
 }
 
@@ -425,17 +244,33 @@ void TimeOutTask(void * pvParameters) {
 
 int main(void) {
     board = BoardCreate();
+    DigitalInputGroupSetDebounce(board->keys, KEY_DEBOUNCE_SAMPLES);
+
+    // Incrementar y decrementar repiten al mantenerlas, las demás teclas reconocen la presión corta y la larga
+    gestures = DigitalGesturesCreate(&gestures_timing);
+    DigitalGesturesAdd(gestures, DigitalInputGroupKey(board->keys, board->set_time), 0);
+    DigitalGesturesAdd(gestures, DigitalInputGroupKey(board->keys, board->set_alarm), 0);
+    DigitalGesturesAdd(gestures, DigitalInputGroupKey(board->keys, board->increment), DIGITAL_GESTURE_OPTION_REPEAT);
+    DigitalGesturesAdd(gestures, DigitalInputGroupKey(board->keys, board->decrement), DIGITAL_GESTURE_OPTION_REPEAT);
+    DigitalGesturesAdd(gestures, DigitalInputGroupKey(board->keys, board->accept), 0);
+    DigitalGesturesAdd(gestures, DigitalInputGroupKey(board->keys, board->cancel), 0);
     clock = ClockCreate(1000);
+    ui = UiCreate(board, clock);
+    ui_events = xQueueCreate(UI_EVENTS_LENGTH, sizeof(ui_event_t));
 
     SysTickInit(1000);
 
-    DisplayFlashDigits(board->screen, 0, 3, 10);
+#ifdef DISPLAY_REFRESH_TASK
     xTaskCreate(DisplayTask, "Display", 512, NULL, 3, NULL);
+#else
+    DisplayTimerStart(ScreenRefreshEvent, board->screen, DISPLAY_SLOT_TIME_US);
+#endif
     xTaskCreate(ClockTask, "Clock", 512, NULL, 1, NULL);
 
-    xTaskCreate(ButtonTask, "Buttons", 512, NULL, 1, NULL);
-    xTaskCreate(DotBlinkTask, "DotBlink", 256, NULL, 1, NULL);
-    xTaskCreate(TimeOutTask, "Timeout", 256, NULL, 1, NULL);
+    xTaskCreate(ButtonTask, "Buttons", 512, NULL, 1, &button_task);
+    xTaskCreate(UiTask, "Ui", 512, NULL, 1, NULL);
+    ClockSetEventHandler(clock, ClockEventHandler, ui_events, CLOCK_EVENT_MINUTE | CLOCK_EVENT_ALARM);
+    KeyEventsStart(KeyEventHandler, button_task);
 
     vTaskStartScheduler();
 
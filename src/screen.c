@@ -22,137 +22,479 @@ SPDX-License-Identifier: MIT
  **/
 
 /* === Headers files inclusions ==================================================================================== */
-#include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include "screen.h"
-#include "poncho.h"
-#include "bsp.h"
+#ifdef SCREEN_INLINE_DRIVER
+#include "screen_driver.h"
+#endif
 /* === Macros definitions ========================================================================================== */
-#ifndef SCREEN_MAX_DIGITS
-#define SCREEN_MAX_DIGITS 8
+
+#define FRAME_FRONT (1 << 0) // Indice del cuadro que muestra ScreenRefresh
+#define FRAME_DIRTY (1 << 1) // El cuadro de escritura tiene cambios que todavía no se muestran
+
+// Campos de la palabra que describe un grupo de parpadeo, se guarda entera para que el refresco nunca la vea a medias
+#define BLINK_DIGITS(blink) ((uint8_t)(blink))
+#define BLINK_DOTS(blink)   ((uint8_t)((blink) >> 8))
+#define BLINK_SHIFT(blink)  ((uint8_t)((blink) >> 16))
+#define BLINK_WORD(digits, dots, shift)                                                                                \
+    ((uint32_t)(digits) | ((uint32_t)(dots) << 8) | ((uint32_t)(shift) << 16))
+
+// Imagen de un carácter a partir del estado de cada segmento, de A a G
+#define GLYPH(a, b, c, d, e, f, g)                                                                                     \
+    ((a) * SEGMENT_A | (b) * SEGMENT_B | (c) * SEGMENT_C | (d) * SEGMENT_D | (e) * SEGMENT_E | (f) * SEGMENT_F |       \
+     (g) * SEGMENT_G)
+
+#ifdef SCREEN_INLINE_DRIVER
+// El controlador se resuelve al compilar, el refresco queda en línea y el indicado al crear la pantalla no se usa
+#define DRIVER_PRECOMPUTES(screen)                    true
+#define DRIVER_ENCODE(screen, digit, segments, masks) ScreenDriverDigitEncode(digit, segments, masks)
+#define DRIVER_WRITE(screen, masks)                   ScreenDriverDigitWrite(masks)
+#else
+#define DRIVER_PRECOMPUTES(screen)                    ((screen)->driver->DigitWrite != NULL)
+#define DRIVER_ENCODE(screen, digit, segments, masks) (screen)->driver->DigitEncode(digit, segments, masks)
+#define DRIVER_WRITE(screen, masks)                   (screen)->driver->DigitWrite(masks)
+#endif
+
+#if SCREEN_MAX_DIGITS > 8
+#error "SCREEN_MAX_DIGITS no puede ser mayor a 8, las máscaras de parpadeo tienen un bit por dígito"
+#endif
+
+#if (SCREEN_MARQUEE_LENGTH < 2 * SCREEN_MAX_DIGITS) || (SCREEN_MARQUEE_LENGTH > 255)
+#error "SCREEN_MARQUEE_LENGTH debe alcanzar para dos pantallas completas y no superar 255"
 #endif
 
 /* === Private data type declarations ============================================================================== */
 
 struct screen_s {
+    screen_driver_t driver;
+    // Escrituras precalculadas de cada cuadro, sin el punto para su parpadeo y de los dígitos apagados
+    screen_digit_masks_t masks[2][SCREEN_MAX_DIGITS];
+    screen_digit_masks_t nodot[2][SCREEN_MAX_DIGITS];
+    screen_digit_masks_t blank[SCREEN_MAX_DIGITS];
+    uint32_t blink[SCREEN_BLINK_GROUPS]; // Dígitos, puntos y exponente de cada grupo de parpadeo
+    uint16_t phase;                      // Barridos completos, los grupos de parpadeo miran uno de sus bits
     uint8_t digits;
     uint8_t dots; // Nuevo: número de puntos
     uint8_t currentDigit;
-    uint8_t flashing_from;
-    uint8_t flashing_to;
-    uint8_t flashing_count;
-    uint16_t flashing_frequency;
-    screen_driver_t driver;
-    uint8_t value[SCREEN_MAX_DIGITS];
-    uint8_t value_dot[SCREEN_MAX_DIGITS]; // Nuevo: estado de los puntos
+    uint8_t off_digits; // Dígitos apagados por el parpadeo durante el barrido actual
+    uint8_t off_dots;   // Puntos apagados por el parpadeo durante el barrido actual
+
+    // Los segmentos se guardan ya codificados en dos cuadros, ScreenRefresh muestra uno mientras se escribe el otro y
+    // los intercambia al empezar un barrido, por lo que nunca muestra un cuadro a medio escribir
+    uint8_t frames[2][SCREEN_MAX_DIGITS];
+    uint8_t state; // Cuadro que se muestra y marca de cambios pendientes, se modifica en forma atómica
+    bool pending;  // El cuadro de escritura ya tenía cambios pendientes al empezar la escritura actual
+
+    // Segmentos del texto de la marquesina con una pantalla de dígitos apagados antes y después, así cada posición del
+    // desplazamiento es una ventana continua del arreglo y al volver a la primera la pantalla ya quedó apagada
+    uint8_t marquee[SCREEN_MARQUEE_LENGTH];
+    uint8_t marquee_length;   // Posiciones del desplazamiento, cero si no hay un texto preparado
+    uint8_t marquee_position; // Posición que se muestra
 };
 
+// Verifica al compilar que la memoria declarada en screen.h alcance para la estructura interna
+typedef char screen_storage_check_t[(sizeof(struct screen_s) <= sizeof(screen_storage_t)) ? 1 : -1];
+
 /* === Private function declarations =============================================================================== */
-static const uint8_t IMAGES[10] = {
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,             // 0
-    SEGMENT_B | SEGMENT_C,                                                             // 1
-    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         // 2
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,                         // 3
-    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,                                     // 4
-    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,                         // 5
-    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,             // 6
-    SEGMENT_A | SEGMENT_B | SEGMENT_C,                                                 // 7
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G, // 8
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G              // 9
+
+/**
+ * @brief Inicializa una pantalla en la memoria indicada, que puede venir de la reserva o de la aplicación.
+ */
+static screen_t ScreenInit(screen_t screen, uint8_t digits, uint8_t dots, screen_driver_t driver);
+
+/**
+ * @brief Comienza una escritura y devuelve el cuadro que no se está mostrando, con el contenido más reciente.
+ */
+static uint8_t FrameBegin(screen_t screen);
+
+/**
+ * @brief Termina una escritura, el cuadro se muestra desde el próximo barrido si tiene cambios.
+ */
+static void FrameEnd(screen_t screen, bool changed);
+
+/**
+ * @brief Cambia un dígito del cuadro de escritura conservando los bits indicados y precalcula sus escrituras.
+ * @return true si el dígito cambió.
+ */
+static bool FrameUpdate(screen_t screen, uint8_t frame, uint8_t position, uint8_t segments, uint8_t keep);
+
+/**
+ * @brief Muestra el cuadro de escritura si tiene cambios, se llama al empezar un barrido.
+ */
+static void FrameSwap(screen_t screen);
+
+/**
+ * @brief Escribe los segmentos de todos los dígitos conservando sus puntos, los que sobran se apagan.
+ */
+static void WriteSegments(screen_t screen, const uint8_t * segments, uint8_t size);
+
+/**
+ * @brief Avanza el contador de barridos y calcula los dígitos y puntos que se apagan en el nuevo barrido.
+ */
+static void BlinkUpdate(screen_t screen);
+
+// Caracteres ASCII definidos a partir de sus segmentos, los que no figuran quedan apagados. Las letras que no se
+// pueden distinguir en 7 segmentos usan la misma imagen en mayúscula y minúscula
+static const uint8_t FONT[128] = {
+    //            A  B  C  D  E  F  G
+    [' '] = GLYPH(0, 0, 0, 0, 0, 0, 0),
+    ['"'] = GLYPH(0, 1, 0, 0, 0, 1, 0),
+    ['\''] = GLYPH(0, 0, 0, 0, 0, 1, 0),
+    ['-'] = GLYPH(0, 0, 0, 0, 0, 0, 1),
+    ['='] = GLYPH(0, 0, 0, 1, 0, 0, 1),
+    ['?'] = GLYPH(1, 1, 0, 0, 1, 0, 1),
+    ['['] = GLYPH(1, 0, 0, 1, 1, 1, 0),
+    [']'] = GLYPH(1, 1, 1, 1, 0, 0, 0),
+    ['_'] = GLYPH(0, 0, 0, 1, 0, 0, 0),
+    ['0'] = GLYPH(1, 1, 1, 1, 1, 1, 0),
+    ['1'] = GLYPH(0, 1, 1, 0, 0, 0, 0),
+    ['2'] = GLYPH(1, 1, 0, 1, 1, 0, 1),
+    ['3'] = GLYPH(1, 1, 1, 1, 0, 0, 1),
+    ['4'] = GLYPH(0, 1, 1, 0, 0, 1, 1),
+    ['5'] = GLYPH(1, 0, 1, 1, 0, 1, 1),
+    ['6'] = GLYPH(1, 0, 1, 1, 1, 1, 1),
+    ['7'] = GLYPH(1, 1, 1, 0, 0, 0, 0),
+    ['8'] = GLYPH(1, 1, 1, 1, 1, 1, 1),
+    ['9'] = GLYPH(1, 1, 1, 1, 0, 1, 1),
+    ['A'] = GLYPH(1, 1, 1, 0, 1, 1, 1),
+    ['B'] = GLYPH(0, 0, 1, 1, 1, 1, 1),
+    ['C'] = GLYPH(1, 0, 0, 1, 1, 1, 0),
+    ['D'] = GLYPH(0, 1, 1, 1, 1, 0, 1),
+    ['E'] = GLYPH(1, 0, 0, 1, 1, 1, 1),
+    ['F'] = GLYPH(1, 0, 0, 0, 1, 1, 1),
+    ['G'] = GLYPH(1, 0, 1, 1, 1, 1, 0),
+    ['H'] = GLYPH(0, 1, 1, 0, 1, 1, 1),
+    ['I'] = GLYPH(0, 0, 0, 0, 1, 1, 0),
+    ['J'] = GLYPH(0, 1, 1, 1, 1, 0, 0),
+    ['K'] = GLYPH(1, 0, 1, 0, 1, 1, 1),
+    ['L'] = GLYPH(0, 0, 0, 1, 1, 1, 0),
+    ['M'] = GLYPH(1, 0, 1, 0, 1, 0, 0),
+    ['N'] = GLYPH(1, 1, 1, 0, 1, 1, 0),
+    ['O'] = GLYPH(1, 1, 1, 1, 1, 1, 0),
+    ['P'] = GLYPH(1, 1, 0, 0, 1, 1, 1),
+    ['Q'] = GLYPH(1, 1, 1, 0, 0, 1, 1),
+    ['R'] = GLYPH(0, 0, 0, 0, 1, 0, 1),
+    ['S'] = GLYPH(1, 0, 1, 1, 0, 1, 1),
+    ['T'] = GLYPH(0, 0, 0, 1, 1, 1, 1),
+    ['U'] = GLYPH(0, 1, 1, 1, 1, 1, 0),
+    ['V'] = GLYPH(0, 1, 1, 1, 1, 1, 0),
+    ['W'] = GLYPH(0, 1, 0, 1, 0, 1, 0),
+    ['X'] = GLYPH(0, 1, 1, 0, 1, 1, 1),
+    ['Y'] = GLYPH(0, 1, 1, 1, 0, 1, 1),
+    ['Z'] = GLYPH(1, 1, 0, 1, 1, 0, 1),
+    ['a'] = GLYPH(1, 1, 1, 0, 1, 1, 1),
+    ['b'] = GLYPH(0, 0, 1, 1, 1, 1, 1),
+    ['c'] = GLYPH(0, 0, 0, 1, 1, 0, 1),
+    ['d'] = GLYPH(0, 1, 1, 1, 1, 0, 1),
+    ['e'] = GLYPH(1, 0, 0, 1, 1, 1, 1),
+    ['f'] = GLYPH(1, 0, 0, 0, 1, 1, 1),
+    ['g'] = GLYPH(1, 0, 1, 1, 1, 1, 0),
+    ['h'] = GLYPH(0, 0, 1, 0, 1, 1, 1),
+    ['i'] = GLYPH(0, 0, 1, 0, 0, 0, 0),
+    ['j'] = GLYPH(0, 1, 1, 1, 1, 0, 0),
+    ['k'] = GLYPH(1, 0, 1, 0, 1, 1, 1),
+    ['l'] = GLYPH(0, 0, 0, 1, 1, 1, 0),
+    ['m'] = GLYPH(1, 0, 1, 0, 1, 0, 0),
+    ['n'] = GLYPH(0, 0, 1, 0, 1, 0, 1),
+    ['o'] = GLYPH(0, 0, 1, 1, 1, 0, 1),
+    ['p'] = GLYPH(1, 1, 0, 0, 1, 1, 1),
+    ['q'] = GLYPH(1, 1, 1, 0, 0, 1, 1),
+    ['r'] = GLYPH(0, 0, 0, 0, 1, 0, 1),
+    ['s'] = GLYPH(1, 0, 1, 1, 0, 1, 1),
+    ['t'] = GLYPH(0, 0, 0, 1, 1, 1, 1),
+    ['u'] = GLYPH(0, 0, 1, 1, 1, 0, 0),
+    ['v'] = GLYPH(0, 0, 1, 1, 1, 0, 0),
+    ['w'] = GLYPH(0, 1, 0, 1, 0, 1, 0),
+    ['x'] = GLYPH(0, 1, 1, 0, 1, 1, 1),
+    ['y'] = GLYPH(0, 1, 1, 1, 0, 1, 1),
+    ['z'] = GLYPH(1, 1, 0, 1, 1, 0, 1)
 };
 
 /* === Private variable definitions ================================================================================ */
 
+static struct screen_s instances[SCREEN_MAX_INSTANCES]; // Reserva de pantallas que entrega ScreenCreate
+static uint8_t instances_used;                          // Cantidad de pantallas ya entregadas por ScreenCreate
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
-/* === Public function implementation ============================================================================== */
-
-screen_t ScreenCreate(uint8_t digits, uint8_t dots, screen_driver_t driver) {
-    screen_t screen = malloc(sizeof(struct screen_s));
+static screen_t ScreenInit(screen_t screen, uint8_t digits, uint8_t dots, screen_driver_t driver) {
     if (digits > SCREEN_MAX_DIGITS) {
         digits = SCREEN_MAX_DIGITS;
     }
-    if (screen != NULL) {
-        screen->digits = digits;
-        screen->dots = dots;
-        screen->driver = driver;
-        screen->currentDigit = 0;
-        screen->flashing_count = 0;
-        screen->flashing_frequency = 0;
+    memset(screen, 0, sizeof(struct screen_s));
+    screen->digits = digits;
+    screen->dots = dots;
+    screen->driver = driver;
+
+    if (DRIVER_PRECOMPUTES(screen)) {
+        for (uint8_t i = 0; i < digits; i++) {
+            DRIVER_ENCODE(screen, i, 0, &screen->blank[i]);
+            DRIVER_ENCODE(screen, i, 0, &screen->masks[0][i]);
+            DRIVER_ENCODE(screen, i, 0, &screen->nodot[0][i]);
+        }
+    }
+    return screen;
+}
+
+static uint8_t FrameBegin(screen_t screen) {
+    // Sin la marca de cambios ScreenRefresh no intercambia los cuadros mientras dura la escritura
+    uint8_t state = __atomic_fetch_and(&screen->state, (uint8_t)~FRAME_DIRTY, __ATOMIC_ACQUIRE);
+    uint8_t front = state & FRAME_FRONT;
+    uint8_t back = front ^ 1;
+
+    screen->pending = (state & FRAME_DIRTY) != 0;
+    if (!screen->pending) {
+        // El último cuadro escrito ya se muestra, se parte de su contenido
+        memcpy(screen->frames[back], screen->frames[front], screen->digits);
+        memcpy(screen->masks[back], screen->masks[front], screen->digits * sizeof(screen_digit_masks_t));
+        memcpy(screen->nodot[back], screen->nodot[front], screen->digits * sizeof(screen_digit_masks_t));
+    }
+    return back;
+}
+
+static void FrameEnd(screen_t screen, bool changed) {
+    if (changed || screen->pending) {
+        __atomic_fetch_or(&screen->state, FRAME_DIRTY, __ATOMIC_RELEASE);
+    }
+}
+
+static bool FrameUpdate(screen_t screen, uint8_t frame, uint8_t position, uint8_t segments, uint8_t keep) {
+    uint8_t value = (screen->frames[frame][position] & keep) | (segments & ~keep);
+    bool changed = (value != screen->frames[frame][position]);
+
+    if (changed) {
+        screen->frames[frame][position] = value;
+        if (DRIVER_PRECOMPUTES(screen)) {
+            DRIVER_ENCODE(screen, position, value, &screen->masks[frame][position]);
+            DRIVER_ENCODE(screen, position, value & ~SEGMENT_P, &screen->nodot[frame][position]);
+        }
+    }
+    return changed;
+}
+
+static void WriteSegments(screen_t screen, const uint8_t * segments, uint8_t size) {
+    uint8_t frame = FrameBegin(screen);
+    bool changed = false;
+
+    for (uint8_t i = 0; i < screen->digits; i++) {
+        changed |= FrameUpdate(screen, frame, i, (i < size) ? segments[i] : 0, SEGMENT_P);
+    }
+    FrameEnd(screen, changed);
+}
+
+static void BlinkUpdate(screen_t screen) {
+    uint8_t off_digits = 0;
+    uint8_t off_dots = 0;
+
+    screen->phase++;
+    for (uint8_t group = 0; group < SCREEN_BLINK_GROUPS; group++) {
+        uint32_t blink = __atomic_load_n(&screen->blink[group], __ATOMIC_RELAXED);
+        if ((screen->phase >> BLINK_SHIFT(blink)) & 1) {
+            off_digits |= BLINK_DIGITS(blink);
+            off_dots |= BLINK_DOTS(blink);
+        }
+    }
+    screen->off_digits = off_digits;
+    screen->off_dots = off_dots;
+}
+
+static void FrameSwap(screen_t screen) {
+    uint8_t state = __atomic_load_n(&screen->state, __ATOMIC_ACQUIRE);
+
+    if (state & FRAME_DIRTY) {
+        // Si una escritura empezó mientras tanto se borró la marca y el intercambio queda para el próximo barrido
+        __atomic_compare_exchange_n(&screen->state, &state, (uint8_t)((state ^ FRAME_FRONT) & ~FRAME_DIRTY), false,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
     }
+}
+
+/* === Public function implementation ============================================================================== */
 
+screen_t ScreenCreate(uint8_t digits, uint8_t dots, screen_driver_t driver) {
+    screen_t screen = NULL;
+
+    if (instances_used < SCREEN_MAX_INSTANCES) {
+        screen = ScreenInit(&instances[instances_used++], digits, dots, driver);
+    }
+    return screen;
+}
+
+screen_t ScreenCreateStatic(screen_storage_t * storage, uint8_t digits, uint8_t dots, screen_driver_t driver) {
+    screen_t screen = NULL;
+
+    if (storage != NULL) {
+        screen = ScreenInit((screen_t)storage, digits, dots, driver);
+    }
     return screen;
 }
 
 void ScreenWriteBCD(screen_t screen, uint8_t * value, uint8_t size) {
-    memset(screen->value, 0, sizeof(screen->value));
+    uint8_t frame = FrameBegin(screen);
+    bool changed = false;
 
     if (size > screen->digits) {
         size = screen->digits;
     }
-    for (uint8_t i = 0; i < size; i++) {
-        screen->value[i] = IMAGES[value[i]];
+    for (uint8_t i = 0; i < screen->digits; i++) {
+        uint8_t segments = ((i < size) && (value[i] < 10)) ? FONT['0' + value[i]] : 0;
+        changed |= FrameUpdate(screen, frame, i, segments, SEGMENT_P);
     }
+    FrameEnd(screen, changed);
+}
+
+void ScreenWriteDigit(screen_t screen, uint8_t position, uint8_t value) {
+    if (position < screen->digits) {
+        uint8_t frame = FrameBegin(screen);
+        uint8_t segments = (value < 10) ? FONT['0' + value] : 0;
+
+        FrameEnd(screen, FrameUpdate(screen, frame, position, segments, SEGMENT_P));
+    }
+}
+
+uint8_t ScreenGlyph(char character) {
+    uint8_t code = (uint8_t)character;
+
+    return (code < sizeof(FONT)) ? FONT[code] : 0;
+}
+
+void ScreenWriteText(screen_t screen, const char * text) {
+    uint8_t segments[SCREEN_MAX_DIGITS];
+    uint8_t size = 0;
+
+    while ((size < screen->digits) && (text[size] != '\0')) {
+        segments[size] = ScreenGlyph(text[size]);
+        size++;
+    }
+    WriteSegments(screen, segments, size);
+}
+
+int ScreenMarqueeStart(screen_t screen, const char * text) {
+    int result = 0;
+    size_t size = text ? strlen(text) : 0;
+
+    if ((!screen) || (!text) || (size > (size_t)(SCREEN_MARQUEE_LENGTH - 2 * screen->digits))) {
+        result = -1;
+    } else {
+        // El texto entra desde la derecha y sale por la izquierda hasta dejar la pantalla apagada
+        memset(screen->marquee, 0, sizeof(screen->marquee));
+        for (size_t i = 0; i < size; i++) {
+            screen->marquee[screen->digits + i] = ScreenGlyph(text[i]);
+        }
+        screen->marquee_length = (uint8_t)(size + screen->digits);
+        screen->marquee_position = 0;
+        WriteSegments(screen, screen->marquee, screen->digits);
+    }
+    return result;
+}
+
+bool ScreenMarqueeStep(screen_t screen) {
+    bool restarted = false;
+
+    if (screen->marquee_length) {
+        screen->marquee_position++;
+        if (screen->marquee_position == screen->marquee_length) {
+            screen->marquee_position = 0;
+            restarted = true;
+        }
+        WriteSegments(screen, &screen->marquee[screen->marquee_position], screen->digits);
+    }
+    return restarted;
 }
 
 void ScreenWriteDOT(screen_t screen, uint8_t * value_dot, uint8_t size) {
-    memset(screen->value_dot, 0, sizeof(screen->value_dot));
+    uint8_t frame = FrameBegin(screen);
+    bool changed = false;
 
     if (size > screen->dots) {
         size = screen->dots;
     }
-    for (uint8_t i = 0; i < size; i++) {
-        if (value_dot[i]) {
-            screen->value_dot[i] = SEGMENT_P; // Asignar el segmento del punto
-        }
+    for (uint8_t i = 0; i < screen->digits; i++) {
+        uint8_t segments = ((i < size) && value_dot[i]) ? SEGMENT_P : 0;
+        changed |= FrameUpdate(screen, frame, i, segments, (uint8_t)~SEGMENT_P);
     }
+    FrameEnd(screen, changed);
 }
 
 void ScreenRefresh(screen_t screen) {
-    uint8_t segments;
+    uint8_t front;
+    uint8_t digit;
+    uint8_t bit;
 
-    screen->driver->DigitsTurnOff();
     screen->currentDigit = (screen->currentDigit + 1) % screen->digits;
+    digit = screen->currentDigit;
+    bit = 1 << digit;
 
-    // segments = screen->value[screen->currentDigit];
-    segments = screen->value[screen->currentDigit] | screen->value_dot[screen->currentDigit];
+    if (digit == 0) {
+        FrameSwap(screen);
+        BlinkUpdate(screen);
+    }
+    front = __atomic_load_n(&screen->state, __ATOMIC_ACQUIRE) & FRAME_FRONT;
 
-    if (screen->flashing_frequency != 0) {
-        if (screen->currentDigit == 0) {
-            screen->flashing_count = (screen->flashing_count + 1) % (screen->flashing_frequency);
+    if (DRIVER_PRECOMPUTES(screen)) {
+        // Las escrituras ya están calculadas, el refresco es una secuencia fija de escrituras de puerto
+        if (screen->off_digits & bit) {
+            DRIVER_WRITE(screen, &screen->blank[digit]);
+        } else if (screen->off_dots & bit) {
+            DRIVER_WRITE(screen, &screen->nodot[front][digit]);
+        } else {
+            DRIVER_WRITE(screen, &screen->masks[front][digit]);
         }
-        if (screen->flashing_count < (screen->flashing_frequency / 2)) {
-            if (screen->currentDigit >= screen->flashing_from) {
-                if (screen->currentDigit <= screen->flashing_to) {
-                    segments = 0; // Flashing off
-                }
-            }
+    } else {
+        uint8_t segments = screen->frames[front][digit];
+
+        if (screen->off_digits & bit) {
+            segments = 0;
+        } else if (screen->off_dots & bit) {
+            segments &= ~SEGMENT_P;
         }
+        screen->driver->DigitsTurnOff();
+        screen->driver->SegmentsUpdate(segments);
+        screen->driver->DigitTurnOn(digit);
+    }
+}
+
+void ScreenRefreshEvent(void * screen) {
+    ScreenRefresh((screen_t)screen);
+}
+
+int ScreenSetBlink(screen_t screen, uint8_t group, uint8_t digits, uint8_t dots, uint8_t shift) {
+    int result = 0;
+
+    if ((!screen) || (group >= SCREEN_BLINK_GROUPS) || (shift > SCREEN_BLINK_MAX_SHIFT)) {
+        result = -1;
+    } else {
+        __atomic_store_n(&screen->blink[group], BLINK_WORD(digits, dots, shift), __ATOMIC_RELAXED);
     }
-    screen->driver->SegmentsUpdate(segments);
-    screen->driver->DigitTurnOn(screen->currentDigit);
+    return result;
 }
 
 int DisplayFlashDigits(screen_t screen, uint8_t from, uint8_t to, uint16_t divisor) {
     int result = 0;
+    uint8_t shift = 0;
+
     if ((from > to) || (from >= SCREEN_MAX_DIGITS) || (to >= SCREEN_MAX_DIGITS)) {
         result = -1;
     } else if (!screen) {
         result = -1;
+    } else if (divisor == 0) {
+        result = ScreenSetBlink(screen, 0, 0, 0, 0);
     } else {
-        screen->flashing_from = from;
-        screen->flashing_to = to;
-        screen->flashing_frequency = 2 * divisor;
-        screen->flashing_count = 0;
+        while (divisor >>= 1) {
+            shift++;
+        }
+        result = ScreenSetBlink(screen, 0, (uint8_t)((2U << to) - (1U << from)), 0, shift);
     }
     return result;
 }
 
 void ScreenToggleDot(screen_t screen, uint8_t position) {
-    if (position < SCREEN_MAX_DIGITS) {
-        screen->value_dot[position] ^= SEGMENT_P;
+    if (position < screen->digits) {
+        uint8_t frame = FrameBegin(screen);
+
+        FrameEnd(screen, FrameUpdate(screen, frame, position, ~screen->frames[frame][position], (uint8_t)~SEGMENT_P));
     }
 }
 
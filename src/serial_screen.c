@@ -0,0 +1,237 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file serial_screen.c
+ ** @brief Implementación de las pantallas de 7 segmentos encadenadas por una interfaz serie.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stddef.h>
+#include <string.h>
+#include "serial_screen.h"
+#include "screen.h"
+
+/* === Macros definitions ========================================================================================== */
+
+// Registros de los controladores tipo MAX7219, los dígitos ocupan las direcciones 1 a 8
+#define MAX7219_NO_OP        0x00
+#define MAX7219_DIGIT_0      0x01
+#define MAX7219_DECODE_MODE  0x09
+#define MAX7219_INTENSITY    0x0A
+#define MAX7219_SCAN_LIMIT   0x0B
+#define MAX7219_SHUTDOWN     0x0C
+#define MAX7219_DISPLAY_TEST 0x0F
+
+#if SERIAL_SCREEN_MAX_DIGITS > 255
+#error "SERIAL_SCREEN_MAX_DIGITS no puede ser mayor a 255, los dígitos se indican con 8 bits"
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+struct serial_screen_s {
+    serial_transport_t transport;
+    uint8_t type;
+    uint8_t digits;
+    uint8_t devices;                            // Controladores de la cadena, en las cadenas tipo MAX7219
+    bool sent_valid;                            // La cadena ya muestra el contenido de sent
+    uint8_t segments[SERIAL_SCREEN_MAX_DIGITS]; // Segmentos escritos por la aplicación
+    uint8_t sent[SERIAL_SCREEN_MAX_DIGITS];     // Segmentos que muestra la cadena
+    uint8_t buffer[SERIAL_SCREEN_BUFFER_SIZE];  // Tramas que se entregan juntas al transporte
+};
+
+// Verifica al compilar que la memoria declarada en serial_screen.h alcance para la estructura interna
+typedef char storage_check_t[(sizeof(struct serial_screen_s) <= sizeof(serial_screen_storage_t)) ? 1 : -1];
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Inicializa una cadena en la memoria indicada, que puede venir de la reserva o de la aplicación.
+ */
+static serial_screen_t SerialScreenInit(serial_screen_t screen, serial_screen_type_t type, uint8_t digits,
+                                        serial_transport_t transport);
+
+/**
+ * @brief Envía el mismo registro y valor a todos los controladores de una cadena tipo MAX7219.
+ */
+static void Max7219Broadcast(serial_screen_t screen, uint8_t address, uint8_t value);
+
+/**
+ * @brief Convierte los segmentos de screen.h al orden de bits de los controladores tipo MAX7219, punto en el bit 7 y
+ * segmentos A a G en los bits 6 a 0.
+ */
+static uint8_t Max7219Segments(uint8_t segments);
+
+/**
+ * @brief Arma las tramas de una cadena de registros de desplazamiento, la cadena completa si cambió algún dígito.
+ * @return Bytes armados en el buffer.
+ */
+static uint16_t ShiftRegisterFrames(serial_screen_t screen);
+
+/**
+ * @brief Arma las tramas de una cadena tipo MAX7219, una por cada posición en la que cambió algún controlador.
+ * @return Bytes armados en el buffer.
+ */
+static uint16_t Max7219Frames(serial_screen_t screen);
+
+/* === Private variable definitions ================================================================================ */
+
+static struct serial_screen_s instances[SERIAL_SCREEN_MAX_INSTANCES]; // Reserva de cadenas de SerialScreenCreate
+static uint8_t instances_used; // Cantidad de cadenas ya entregadas por SerialScreenCreate
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static serial_screen_t SerialScreenInit(serial_screen_t screen, serial_screen_type_t type, uint8_t digits,
+                                        serial_transport_t transport) {
+    memset(screen, 0, sizeof(struct serial_screen_s));
+    screen->transport = transport;
+    screen->type = type;
+    screen->digits = digits;
+    screen->devices = SERIAL_SCREEN_DEVICES(digits);
+
+    if (type == SERIAL_SCREEN_MAX7219) {
+        Max7219Broadcast(screen, MAX7219_DISPLAY_TEST, 0);
+        Max7219Broadcast(screen, MAX7219_DECODE_MODE, 0);
+        Max7219Broadcast(screen, MAX7219_SCAN_LIMIT, SERIAL_SCREEN_DEVICE_DIGITS - 1);
+        Max7219Broadcast(screen, MAX7219_INTENSITY, 0x08);
+        Max7219Broadcast(screen, MAX7219_SHUTDOWN, 1);
+    }
+    return screen;
+}
+
+static void Max7219Broadcast(serial_screen_t screen, uint8_t address, uint8_t value) {
+    uint16_t size = 2 * screen->devices;
+
+    for (uint16_t i = 0; i < size; i += 2) {
+        screen->buffer[i] = address;
+        screen->buffer[i + 1] = value;
+    }
+    screen->transport->Send(screen->transport->object, screen->buffer, size, size);
+}
+
+static uint8_t Max7219Segments(uint8_t segments) {
+    uint8_t result = (segments & SEGMENT_P) ? 0x80 : 0;
+
+    for (uint8_t bit = 0; bit < 7; bit++) {
+        if (segments & (1 << bit)) {
+            result |= 1 << (6 - bit);
+        }
+    }
+    return result;
+}
+
+static uint16_t ShiftRegisterFrames(serial_screen_t screen) {
+    uint16_t size = 0;
+
+    // Un registro de desplazamiento no se puede escribir solo, si cambió algún dígito se envía la cadena completa
+    if ((!screen->sent_valid) || memcmp(screen->segments, screen->sent, screen->digits)) {
+        memcpy(screen->buffer, screen->segments, screen->digits);
+        size = screen->digits;
+    }
+    return size;
+}
+
+static uint16_t Max7219Frames(serial_screen_t screen) {
+    uint16_t size = 0;
+
+    for (uint8_t row = 0; row < SERIAL_SCREEN_DEVICE_DIGITS; row++) {
+        uint8_t * frame = &screen->buffer[size];
+        bool changed = false;
+
+        // El primer controlador de la trama es el más alejado del microcontrolador, el que tiene los primeros dígitos
+        for (uint8_t device = 0; device < screen->devices; device++) {
+            uint16_t digit = device * SERIAL_SCREEN_DEVICE_DIGITS + row;
+
+            if ((digit < screen->digits) &&
+                ((!screen->sent_valid) || (screen->segments[digit] != screen->sent[digit]))) {
+                frame[2 * device] = MAX7219_DIGIT_0 + row;
+                frame[2 * device + 1] = Max7219Segments(screen->segments[digit]);
+                changed = true;
+            } else {
+                frame[2 * device] = MAX7219_NO_OP;
+                frame[2 * device + 1] = 0;
+            }
+        }
+        if (changed) {
+            size += 2 * screen->devices;
+        }
+    }
+    return size;
+}
+
+/* === Public function implementation ============================================================================== */
+
+serial_screen_t SerialScreenCreate(serial_screen_type_t type, uint8_t digits, serial_transport_t transport) {
+    serial_screen_t screen = NULL;
+
+    if ((instances_used < SERIAL_SCREEN_MAX_INSTANCES) && (digits > 0) && (digits <= SERIAL_SCREEN_MAX_DIGITS) &&
+        (transport != NULL)) {
+        screen = SerialScreenInit(&instances[instances_used++], type, digits, transport);
+    }
+    return screen;
+}
+
+serial_screen_t SerialScreenCreateStatic(serial_screen_storage_t * storage, serial_screen_type_t type, uint8_t digits,
+                                         serial_transport_t transport) {
+    serial_screen_t screen = NULL;
+
+    if ((storage != NULL) && (digits > 0) && (digits <= SERIAL_SCREEN_MAX_DIGITS) && (transport != NULL)) {
+        screen = SerialScreenInit((serial_screen_t)storage, type, digits, transport);
+    }
+    return screen;
+}
+
+void SerialScreenWriteSegments(serial_screen_t screen, uint8_t position, const uint8_t * segments, uint8_t count) {
+    for (uint8_t i = 0; (i < count) && (position + i < screen->digits); i++) {
+        screen->segments[position + i] = segments[i];
+    }
+}
+
+void SerialScreenWriteText(serial_screen_t screen, const char * text) {
+    uint8_t i = 0;
+
+    for (; (i < screen->digits) && (text[i] != '\0'); i++) {
+        screen->segments[i] = ScreenGlyph(text[i]);
+    }
+    memset(&screen->segments[i], 0, screen->digits - i);
+}
+
+uint16_t SerialScreenUpdate(serial_screen_t screen) {
+    uint16_t size;
+    uint16_t frame_size;
+
+    if (screen->type == SERIAL_SCREEN_MAX7219) {
+        size = Max7219Frames(screen);
+        frame_size = 2 * screen->devices;
+    } else {
+        size = ShiftRegisterFrames(screen);
+        frame_size = screen->digits;
+    }
+
+    if (size) {
+        screen->transport->Send(screen->transport->object, screen->buffer, size, frame_size);
+        memcpy(screen->sent, screen->segments, screen->digits);
+        screen->sent_valid = true;
+    }
+    return size;
+}
+
+/* === End of documentation ========================================================================================
+ */
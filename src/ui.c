@@ -0,0 +1,427 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file ui.c
+ ** @brief Interfaz de usuario del reloj despertador, con una tabla de transiciones constante.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "ui.h"
+#include "bcd.h"
+#include "screen.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Private macros definitions ================================================================================ */
+
+#define UI_MODES    (MODE_ALARM_TRIGGERED + 1) // Cantidad de modos de la interfaz, filas de la tabla de transiciones
+#define MODE_RETURN UI_MODES // Modo siguiente que vuelve al modo desde el que se entró a editar
+
+#define INDICATORS_ALARM (BOARD_LED_BLUE | BOARD_BUZZER) // Indicadores que cambian al sonar y al atender la alarma
+
+#define COLON_BLINK_GROUP 1        // Grupo de parpadeo de los dos puntos, el grupo 0 lo usa DisplayFlashDigits
+#define COLON_BLINK_DOTS  (1 << 1) // Los dos puntos son el punto del segundo dígito
+#define COLON_BLINK_SHIFT 6        // 64 barridos encendidos y 64 apagados, un segundo cada uno
+
+#define EDIT_BLINK_SWEEPS 8 // Los dígitos editados pasan 8 barridos encendidos y 8 apagados, 4 parpadeos por segundo
+
+#define ALARM_DOT      3 // Punto que indica que la alarma está habilitada
+#define SNOOZE_MINUTES 5 // Minutos que se pospone la alarma al aceptarla mientras suena
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Acción de una transición.
+ * @return true si la transición se completa, false si la acción la rechaza y la interfaz se queda en el mismo modo.
+ */
+typedef bool (*ui_action_t)(ui_t self);
+
+/**
+ * @brief Entrada de la tabla de transiciones, una acción nula indica que el evento se descarta en ese modo.
+ */
+typedef struct {
+    ui_action_t action; // Acción que se ejecuta al recibir el evento
+    uint8_t next;       // Modo siguiente, un system_mode_t o MODE_RETURN
+} ui_transition_t;
+
+struct ui_s {
+    Board_t board;     // Placa con la pantalla y los indicadores
+    clock_t clock;     // Reloj que se muestra y se ajusta
+    uint8_t mode;      // Modo actual, un system_mode_t
+    uint8_t back;      // Modo desde el que se entró a editar, al que vuelve MODE_RETURN
+    uint8_t digits[4]; // Dígitos que se muestran, horas y minutos en BCD
+    uint8_t dots[4];   // Puntos que se muestran
+};
+
+// Verifica al compilar que ui_storage_t alcance para la estructura interna
+typedef char ui_storage_check_t[(sizeof(struct ui_s) <= sizeof(ui_storage_t)) ? 1 : -1];
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Inicializa una interfaz en la memoria indicada, que puede venir de la reserva o de la aplicación.
+ */
+static ui_t UiInit(ui_t self, Board_t board, clock_t clock);
+
+/**
+ * @brief Busca el evento en la tabla para el modo actual y, si la acción lo acepta, cambia de modo.
+ */
+static void Transition(ui_t self, ui_event_t event);
+
+/**
+ * @brief Escribe en la pantalla los dígitos y los puntos, con los dos puntos parpadeando mientras se muestra la hora.
+ */
+static void Show(ui_t self);
+
+/**
+ * @brief Convierte los dígitos de la pantalla en una hora con los segundos en cero.
+ */
+static void DigitsToTime(const uint8_t * digits, clock_time_t * time);
+
+/**
+ * @brief Convierte las horas y los minutos de una hora en los dígitos de la pantalla.
+ */
+static void TimeToDigits(uint8_t * digits, const clock_time_t * time);
+
+/**
+ * @brief Suma o resta un paso a un campo de la hora que se está editando, dando la vuelta dentro del campo.
+ */
+static void DigitsStep(uint8_t * digits, bcd_word_t field, bcd_word_t step, bool increment);
+
+static bool ShowTime(ui_t self);
+
+static bool EditTime(ui_t self);
+
+static bool EditAlarm(ui_t self);
+
+static bool EditHours(ui_t self);
+
+static bool EditCancel(ui_t self);
+
+static bool MinutesUp(ui_t self);
+
+static bool MinutesDown(ui_t self);
+
+static bool HoursUp(ui_t self);
+
+static bool HoursDown(ui_t self);
+
+static bool TimeSave(ui_t self);
+
+static bool AlarmSave(ui_t self);
+
+static bool AlarmEnable(ui_t self);
+
+static bool AlarmDisable(ui_t self);
+
+static bool AlarmRing(ui_t self);
+
+static bool AlarmSnooze(ui_t self);
+
+static bool AlarmCancel(ui_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+static struct ui_s instances[UI_MAX_INSTANCES]; // Reserva de interfaces que entrega UiCreate
+static uint8_t instances_used;                  // Cantidad de interfaces ya entregadas por UiCreate
+
+// Modo actual por evento, los eventos que no figuran en un modo se descartan
+static const ui_transition_t transitions[UI_MODES][UI_EVENT_COUNT] = {
+    [MODE_UNSET] = {
+        [UI_EVENT_SET_TIME] = {EditTime, MODE_SET_TIME_MINUTES},
+        [UI_EVENT_SET_ALARM] = {EditAlarm, MODE_SET_ALARM_MINUTES},
+    },
+    [MODE_HOME] = {
+        [UI_EVENT_SET_TIME] = {EditTime, MODE_SET_TIME_MINUTES},
+        [UI_EVENT_SET_ALARM] = {EditAlarm, MODE_SET_ALARM_MINUTES},
+        [UI_EVENT_ACCEPT] = {AlarmEnable, MODE_HOME},
+        [UI_EVENT_CANCEL] = {AlarmDisable, MODE_HOME},
+        [UI_EVENT_MINUTE] = {ShowTime, MODE_HOME},
+        [UI_EVENT_ALARM] = {AlarmRing, MODE_ALARM_TRIGGERED},
+    },
+    [MODE_SET_TIME_MINUTES] = {
+        [UI_EVENT_INCREMENT] = {MinutesUp, MODE_SET_TIME_MINUTES},
+        [UI_EVENT_DECREMENT] = {MinutesDown, MODE_SET_TIME_MINUTES},
+        [UI_EVENT_ACCEPT] = {EditHours, MODE_SET_TIME_HOURS},
+        [UI_EVENT_CANCEL] = {EditCancel, MODE_RETURN},
+        [UI_EVENT_TIMEOUT] = {EditCancel, MODE_RETURN},
+    },
+    [MODE_SET_TIME_HOURS] = {
+        [UI_EVENT_INCREMENT] = {HoursUp, MODE_SET_TIME_HOURS},
+        [UI_EVENT_DECREMENT] = {HoursDown, MODE_SET_TIME_HOURS},
+        [UI_EVENT_ACCEPT] = {TimeSave, MODE_HOME},
+        [UI_EVENT_CANCEL] = {EditCancel, MODE_RETURN},
+        [UI_EVENT_TIMEOUT] = {EditCancel, MODE_RETURN},
+    },
+    [MODE_SET_ALARM_MINUTES] = {
+        [UI_EVENT_INCREMENT] = {MinutesUp, MODE_SET_ALARM_MINUTES},
+        [UI_EVENT_DECREMENT] = {MinutesDown, MODE_SET_ALARM_MINUTES},
+        [UI_EVENT_ACCEPT] = {EditHours, MODE_SET_ALARM_HOURS},
+        [UI_EVENT_CANCEL] = {EditCancel, MODE_RETURN},
+        [UI_EVENT_TIMEOUT] = {EditCancel, MODE_RETURN},
+    },
+    [MODE_SET_ALARM_HOURS] = {
+        [UI_EVENT_INCREMENT] = {HoursUp, MODE_SET_ALARM_HOURS},
+        [UI_EVENT_DECREMENT] = {HoursDown, MODE_SET_ALARM_HOURS},
+        [UI_EVENT_ACCEPT] = {AlarmSave, MODE_RETURN},
+        [UI_EVENT_CANCEL] = {EditCancel, MODE_RETURN},
+        [UI_EVENT_TIMEOUT] = {EditCancel, MODE_RETURN},
+    },
+    [MODE_ALARM_TRIGGERED] = {
+        [UI_EVENT_ACCEPT] = {AlarmSnooze, MODE_HOME},
+        [UI_EVENT_CANCEL] = {AlarmCancel, MODE_HOME},
+        [UI_EVENT_MINUTE] = {ShowTime, MODE_ALARM_TRIGGERED},
+    },
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static ui_t UiInit(ui_t self, Board_t board, clock_t clock) {
+    memset(self, 0, sizeof(struct ui_s));
+    self->board = board;
+    self->clock = clock;
+    self->mode = MODE_UNSET;
+    self->back = MODE_UNSET;
+    self->dots[1] = 1; // Los dos puntos entre las horas y los minutos
+
+    // Hasta que se ajuste la hora toda la pantalla parpadea
+    DisplayFlashDigits(board->screen, 0, 3, EDIT_BLINK_SWEEPS);
+    Show(self);
+    return self;
+}
+
+static void Transition(ui_t self, ui_event_t event) {
+    const ui_transition_t * transition = &transitions[self->mode][event];
+
+    if ((transition->action != NULL) && transition->action(self)) {
+        self->mode = (transition->next == MODE_RETURN) ? self->back : transition->next;
+    }
+}
+
+static void Show(ui_t self) {
+    bool time = (self->mode == MODE_HOME) || (self->mode == MODE_ALARM_TRIGGERED);
+
+    // La pantalla solo cambia de cuadro si se modificaron los dígitos o los puntos
+    ScreenWriteBCD(self->board->screen, self->digits, sizeof(self->digits));
+    ScreenWriteDOT(self->board->screen, self->dots, sizeof(self->dots));
+    ScreenSetBlink(self->board->screen, COLON_BLINK_GROUP, 0, time ? COLON_BLINK_DOTS : 0, COLON_BLINK_SHIFT);
+}
+
+static void DigitsToTime(const uint8_t * digits, clock_time_t * time) {
+    time->bcd[5] = digits[0];
+    time->bcd[4] = digits[1];
+    time->bcd[3] = digits[2];
+    time->bcd[2] = digits[3];
+    time->bcd[1] = 0;
+    time->bcd[0] = 0;
+}
+
+static void TimeToDigits(uint8_t * digits, const clock_time_t * time) {
+    digits[0] = time->bcd[5];
+    digits[1] = time->bcd[4];
+    digits[2] = time->bcd[3];
+    digits[3] = time->bcd[2];
+}
+
+static void DigitsStep(uint8_t * digits, bcd_word_t field, bcd_word_t step, bool increment) {
+    clock_time_t time;
+    DigitsToTime(digits, &time);
+
+    bcd_word_t value = BcdLoad(&time);
+    value = increment ? BcdAddField(value, step, field) : BcdSubtractField(value, step, field);
+    BcdStore(value, &time);
+
+    TimeToDigits(digits, &time);
+}
+
+static bool ShowTime(ui_t self) {
+    clock_time_t time;
+
+    if (ClockGetTime(self->clock, &time)) {
+        TimeToDigits(self->digits, &time);
+    }
+    return true;
+}
+
+static bool EditTime(ui_t self) {
+    self->back = self->mode;
+    DisplayFlashDigits(self->board->screen, 2, 3, EDIT_BLINK_SWEEPS);
+    return true;
+}
+
+static bool EditAlarm(ui_t self) {
+    clock_time_t time;
+
+    if (ClockGetAlarmTime(self->clock, &time)) {
+        TimeToDigits(self->digits, &time);
+    }
+    self->back = self->mode;
+    DisplayFlashDigits(self->board->screen, 2, 3, EDIT_BLINK_SWEEPS);
+    return true;
+}
+
+static bool EditHours(ui_t self) {
+    DisplayFlashDigits(self->board->screen, 0, 1, EDIT_BLINK_SWEEPS);
+    return true;
+}
+
+static bool EditCancel(ui_t self) {
+    if (self->back == MODE_UNSET) {
+        DisplayFlashDigits(self->board->screen, 0, 3, EDIT_BLINK_SWEEPS);
+    } else {
+        DisplayFlashDigits(self->board->screen, 0, 0, 0);
+    }
+    return true;
+}
+
+static bool MinutesUp(ui_t self) {
+    DigitsStep(self->digits, BCD_MINUTES, BCD_ONE_MINUTE, true);
+    return true;
+}
+
+static bool MinutesDown(ui_t self) {
+    DigitsStep(self->digits, BCD_MINUTES, BCD_ONE_MINUTE, false);
+    return true;
+}
+
+static bool HoursUp(ui_t self) {
+    DigitsStep(self->digits, BCD_HOURS, BCD_ONE_HOUR, true);
+    return true;
+}
+
+static bool HoursDown(ui_t self) {
+    DigitsStep(self->digits, BCD_HOURS, BCD_ONE_HOUR, false);
+    return true;
+}
+
+static bool TimeSave(ui_t self) {
+    clock_time_t time;
+
+    DisplayFlashDigits(self->board->screen, 0, 0, 0);
+    DigitsToTime(self->digits, &time);
+    return ClockSetTime(self->clock, &time);
+}
+
+static bool AlarmSave(ui_t self) {
+    clock_time_t time;
+    bool result;
+
+    DigitsToTime(self->digits, &time);
+    result = ClockSetAlarmTime(self->clock, &time);
+    if (result) {
+        ClockEnableAlarm(self->clock);
+        self->dots[ALARM_DOT] = 1;
+        if (self->back == MODE_UNSET) {
+            // Sin la hora ajustada la pantalla vuelve a parpadear en cero
+            memset(self->digits, 0, sizeof(self->digits));
+            DisplayFlashDigits(self->board->screen, 0, 3, EDIT_BLINK_SWEEPS);
+        } else {
+            DisplayFlashDigits(self->board->screen, 0, 0, 0);
+        }
+    }
+    return result;
+}
+
+static bool AlarmEnable(ui_t self) {
+    ClockEnableAlarm(self->clock);
+    self->dots[ALARM_DOT] = 1;
+    return true;
+}
+
+static bool AlarmDisable(ui_t self) {
+    ClockDisableAlarm(self->clock);
+    self->dots[ALARM_DOT] = 0;
+    return true;
+}
+
+static bool AlarmRing(ui_t self) {
+    bool result = ClockIsAlarmTriggered(self->clock);
+
+    if (result) {
+        self->dots[ALARM_DOT] = 1;
+        DigitalOutputGroupWrite(self->board->indicators, INDICATORS_ALARM, BOARD_BUZZER); // Azul y zumbador a la vez
+    }
+    return result;
+}
+
+static bool AlarmSnooze(ui_t self) {
+    ClockSnoozeAlarm(self->clock, SNOOZE_MINUTES);
+    DigitalOutputGroupWrite(self->board->indicators, INDICATORS_ALARM, BOARD_LED_BLUE);
+    return true;
+}
+
+static bool AlarmCancel(ui_t self) {
+    ClockCancelAlarmUntilNextDay(self->clock);
+    DigitalOutputGroupWrite(self->board->indicators, INDICATORS_ALARM, BOARD_LED_BLUE);
+    return true;
+}
+
+/* === Public function definitions ================================================================================= */
+
+ui_t UiCreate(Board_t board, clock_t clock) {
+    ui_t self = NULL;
+
+    if ((board != NULL) && (instances_used < UI_MAX_INSTANCES)) {
+        self = UiInit(&instances[instances_used++], board, clock);
+    }
+    return self;
+}
+
+ui_t UiCreateStatic(ui_storage_t * storage, Board_t board, clock_t clock) {
+    ui_t self = NULL;
+
+    if ((storage != NULL) && (board != NULL)) {
+        self = UiInit((ui_t)storage, board, clock);
+    }
+    return self;
+}
+
+void UiHandleEvent(ui_t self, ui_event_t event) {
+    uint8_t previous = self->mode;
+
+    if (event < UI_EVENT_COUNT) {
+        Transition(self, event);
+    }
+
+    // Al volver al modo normal se muestra la hora
+    if ((self->mode == MODE_HOME) && (previous != MODE_HOME)) {
+        ShowTime(self);
+    }
+
+    // Si la alarma empezó a sonar mientras se editaba, o su evento no llegó, se atiende al volver al modo normal o con
+    // el próximo cambio de minuto
+    bool check = (previous != MODE_HOME) || (event == UI_EVENT_MINUTE);
+    if ((self->mode == MODE_HOME) && check && ClockIsAlarmTriggered(self->clock)) {
+        Transition(self, UI_EVENT_ALARM);
+    }
+    Show(self);
+}
+
+system_mode_t UiGetMode(ui_t self) {
+    return (system_mode_t)self->mode;
+}
+
+bool UiIsEditing(ui_t self) {
+    return (self->mode == MODE_SET_TIME_MINUTES) || (self->mode == MODE_SET_TIME_HOURS) ||
+           (self->mode == MODE_SET_ALARM_MINUTES) || (self->mode == MODE_SET_ALARM_HOURS);
+}
+
+/* === End of documentation ======================================================================================== */
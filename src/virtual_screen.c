@@ -0,0 +1,237 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file virtual_screen.c
+ ** @brief Implementación de la pantalla de 7 segmentos virtual.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "virtual_screen.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define NO_DIGIT 0xFF // Valor de on cuando no hay ningún dígito encendido
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void DigitsTurnOff(void);
+
+static void SegmentsUpdate(uint8_t segments);
+
+static void DigitTurnOn(uint8_t digit);
+
+/**
+ * @brief Termina el encendido del dígito actual y lo guarda en el anillo de registros.
+ */
+static void RecordClose(uint32_t now);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s driver = {
+    .DigitsTurnOff = DigitsTurnOff,
+    .SegmentsUpdate = SegmentsUpdate,
+    .DigitTurnOn = DigitTurnOn,
+};
+
+static struct {
+    virtual_screen_clock_t clock;
+    uint8_t digits;
+    uint8_t segments;                 // Segmentos activos en las salidas simuladas
+    uint8_t on;                       // Dígito encendido, o NO_DIGIT
+    uint8_t on_segments;              // Segmentos con los que se encendió el dígito actual
+    uint32_t on_since;                // Momento en que se encendió el dígito actual
+    uint8_t shown[SCREEN_MAX_DIGITS]; // Últimos segmentos con los que se vio cada dígito
+    // Anillo con los últimos encendidos, se completa al apagarse cada dígito
+    virtual_screen_record_t records[VIRTUAL_SCREEN_RECORDS];
+    uint16_t next;                    // Lugar del anillo donde se guarda el próximo registro
+    uint16_t count;                   // Registros guardados en el anillo
+    uint32_t ghosts;                  // Efectos fantasma detectados desde la creación
+    uint32_t render_period;           // Tiempo mínimo entre dibujos, en microsegundos
+    uint32_t rendered_at;             // Momento del último dibujo
+    bool rendered;                    // Ya se dibujó la pantalla al menos una vez
+} display;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void RecordClose(uint32_t now) {
+    if (display.on != NO_DIGIT) {
+        virtual_screen_record_t * record = &display.records[display.next];
+
+        record->start = display.on_since;
+        record->duration = now - display.on_since;
+        record->digit = display.on;
+        record->segments = display.on_segments;
+        display.next = (display.next + 1) % VIRTUAL_SCREEN_RECORDS;
+        if (display.count < VIRTUAL_SCREEN_RECORDS) {
+            display.count++;
+        }
+        display.on = NO_DIGIT;
+    }
+}
+
+static void DigitsTurnOff(void) {
+    RecordClose(display.clock());
+    display.segments = 0;
+}
+
+static void SegmentsUpdate(uint8_t segments) {
+    if ((display.on != NO_DIGIT) && (segments != display.segments)) {
+        // El dígito encendido muestra por un momento los segmentos de otro
+        display.ghosts++;
+        display.shown[display.on] |= segments;
+    }
+    display.segments = segments;
+}
+
+static void DigitTurnOn(uint8_t digit) {
+    uint32_t now = display.clock();
+
+    if (digit < display.digits) {
+        if (display.on != NO_DIGIT) {
+            // Dos dígitos encendidos a la vez, el anterior se ve con los segmentos del nuevo
+            display.ghosts++;
+            RecordClose(now);
+        }
+        display.on = digit;
+        display.on_segments = display.segments;
+        display.on_since = now;
+        display.shown[digit] = display.segments;
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+screen_driver_t VirtualScreenCreate(uint8_t digits, virtual_screen_clock_t clock, uint16_t render_rate) {
+    screen_driver_t result = NULL;
+
+    if ((digits > 0) && (digits <= SCREEN_MAX_DIGITS) && (clock != NULL)) {
+        memset(&display, 0, sizeof(display));
+        display.clock = clock;
+        display.digits = digits;
+        display.on = NO_DIGIT;
+        display.render_period = render_rate ? 1000000UL / render_rate : 0;
+        result = &driver;
+    }
+    return result;
+}
+
+uint16_t VirtualScreenRecords(virtual_screen_record_t * records, uint16_t count) {
+    uint16_t first;
+
+    if (count > display.count) {
+        count = display.count;
+    }
+    first = (display.next + VIRTUAL_SCREEN_RECORDS - count) % VIRTUAL_SCREEN_RECORDS;
+    for (uint16_t i = 0; i < count; i++) {
+        records[i] = display.records[(first + i) % VIRTUAL_SCREEN_RECORDS];
+    }
+    return count;
+}
+
+void VirtualScreenGetStats(virtual_screen_stats_t * stats) {
+    virtual_screen_record_t records[VIRTUAL_SCREEN_RECORDS];
+    uint32_t on_count[SCREEN_MAX_DIGITS] = {0};
+    uint32_t first_scan = 0;
+    uint32_t last_scan = 0;
+    uint16_t count = VirtualScreenRecords(records, VIRTUAL_SCREEN_RECORDS);
+
+    memset(stats, 0, sizeof(*stats));
+    stats->ghosts = display.ghosts;
+    for (uint16_t i = 0; i < count; i++) {
+        stats->on_time[records[i].digit] += records[i].duration;
+        on_count[records[i].digit]++;
+
+        if (records[i].digit == 0) {
+            if (stats->scans == 0) {
+                first_scan = records[i].start;
+            }
+            last_scan = records[i].start;
+            stats->scans++;
+        }
+        if (i > 0) {
+            uint32_t slot = records[i].start - records[i - 1].start;
+
+            if ((i == 1) || (slot < stats->slot_min)) {
+                stats->slot_min = slot;
+            }
+            if (slot > stats->slot_max) {
+                stats->slot_max = slot;
+            }
+        }
+    }
+
+    for (uint8_t digit = 0; digit < display.digits; digit++) {
+        if (on_count[digit]) {
+            stats->on_time[digit] /= on_count[digit];
+        }
+    }
+    if (stats->scans > 1) {
+        stats->scan_period = (last_scan - first_scan) / (stats->scans - 1);
+    }
+    if (stats->scan_period) {
+        stats->refresh_rate = (1000000UL + stats->scan_period / 2) / stats->scan_period;
+    }
+    stats->jitter = stats->slot_max - stats->slot_min;
+}
+
+bool VirtualScreenRender(char * text, size_t size) {
+    bool result = false;
+    uint32_t now = display.clock();
+    bool due = (!display.rendered) || ((now - display.rendered_at) >= display.render_period);
+
+    if ((display.render_period != 0) && (size >= VIRTUAL_SCREEN_RENDER_SIZE(display.digits)) && due) {
+        // Cada dígito ocupa cuatro columnas de tres líneas, la última columna es el punto
+        for (uint8_t line = 0; line < 3; line++) {
+            for (uint8_t digit = 0; digit < display.digits; digit++) {
+                uint8_t segments = display.shown[digit];
+
+                if (line == 0) {
+                    *text++ = ' ';
+                    *text++ = (segments & SEGMENT_A) ? '_' : ' ';
+                    *text++ = ' ';
+                    *text++ = ' ';
+                } else if (line == 1) {
+                    *text++ = (segments & SEGMENT_F) ? '|' : ' ';
+                    *text++ = (segments & SEGMENT_G) ? '_' : ' ';
+                    *text++ = (segments & SEGMENT_B) ? '|' : ' ';
+                    *text++ = ' ';
+                } else {
+                    *text++ = (segments & SEGMENT_E) ? '|' : ' ';
+                    *text++ = (segments & SEGMENT_D) ? '_' : ' ';
+                    *text++ = (segments & SEGMENT_C) ? '|' : ' ';
+                    *text++ = (segments & SEGMENT_P) ? '.' : ' ';
+                }
+            }
+            *text++ = '\n';
+        }
+        *text = '\0';
+        display.rendered = true;
+        display.rendered_at = now;
+        result = true;
+    }
+    return result;
+}
+
+/* === End of documentation ========================================================================================
+ */
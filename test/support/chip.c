@@ -0,0 +1,96 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file chip.c
+ ** @brief Implementación en el host de las funciones de GPIO de la biblioteca del fabricante.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include <string.h>
+
+/* === Private macros definitions ================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+LPC_GPIO_T host_gpio;
+
+uint32_t host_gpio_port_reads;
+
+uint32_t host_gpio_port_writes;
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+void HostGpioReset(void) {
+    memset(&host_gpio, 0, sizeof(host_gpio));
+    host_gpio_port_reads = 0;
+    host_gpio_port_writes = 0;
+}
+
+void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool setting) {
+    if (setting) {
+        gpio->PIN[port] |= (1UL << pin);
+    } else {
+        gpio->PIN[port] &= ~(1UL << pin);
+    }
+}
+
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output) {
+    if (output) {
+        gpio->DIR[port] |= (1UL << pin);
+    } else {
+        gpio->DIR[port] &= ~(1UL << pin);
+    }
+}
+
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin) {
+    gpio->PIN[port] ^= (1UL << pin);
+}
+
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin) {
+    return (gpio->PIN[port] & (1UL << pin)) != 0;
+}
+
+uint32_t Chip_GPIO_GetPortValue(LPC_GPIO_T * gpio, uint8_t port) {
+    host_gpio_port_reads++;
+    return gpio->PIN[port];
+}
+
+void Chip_GPIO_SetValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask) {
+    host_gpio_port_writes++;
+    gpio->SET[port] = mask;
+    gpio->PIN[port] |= mask;
+}
+
+void Chip_GPIO_ClearValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask) {
+    host_gpio_port_writes++;
+    gpio->CLR[port] = mask;
+    gpio->PIN[port] &= ~mask;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,95 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file chip.h
+ ** @brief Reemplazo en el host de las funciones de GPIO de la biblioteca del fabricante.
+ ** @details Permite compilar los modulos de entradas, salidas y pantalla en las pruebas. Los puertos se simulan con
+ ** variables en memoria que las pruebas pueden consultar y modificar.
+ **/
+
+#ifndef CHIP_H_
+#define CHIP_H_
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define HOST_GPIO_PORTS 8  // Cantidad de puertos GPIO simulados
+#define HOST_GPIO_PINS  32 // Cantidad de terminales de cada puerto simulado
+
+#define LPC_GPIO_PORT (&host_gpio) // Controlador de GPIO que usan los modulos
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Registros simulados del controlador de GPIO, un bit por terminal.
+ * @details Los registros de escritura directa guardan el último valor escrito y no modifican el estado de los
+ * terminales, alcanzan para medir y verificar las escrituras de los controladores en línea.
+ */
+typedef struct {
+    volatile uint8_t B[HOST_GPIO_PORTS][HOST_GPIO_PINS]; // Escritura de un terminal por byte
+    uint32_t DIR[HOST_GPIO_PORTS];                       // Terminales configurados como salida
+    uint32_t PIN[HOST_GPIO_PORTS];                       // Estado de los terminales
+    volatile uint32_t SET[HOST_GPIO_PORTS];              // Último valor escrito en el registro de encendido
+    volatile uint32_t CLR[HOST_GPIO_PORTS];              // Último valor escrito en el registro de apagado
+} LPC_GPIO_T;
+
+/* === Public variable declarations ================================================================================ */
+
+extern LPC_GPIO_T host_gpio;
+
+extern uint32_t host_gpio_port_reads;  // Lecturas de puertos completos desde el último HostGpioReset
+extern uint32_t host_gpio_port_writes; // Escrituras de SET o CLR con Chip_GPIO_SetValue y Chip_GPIO_ClearValue
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Pone todos los terminales simulados como entradas en estado bajo.
+ */
+void HostGpioReset(void);
+
+void Chip_GPIO_SetPinState(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool setting);
+
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin, bool output);
+
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * gpio, uint8_t port, uint8_t pin);
+
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * gpio, uint32_t port, uint8_t pin);
+
+uint32_t Chip_GPIO_GetPortValue(LPC_GPIO_T * gpio, uint8_t port);
+
+void Chip_GPIO_SetValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask);
+
+void Chip_GPIO_ClearValue(LPC_GPIO_T * gpio, uint8_t port, uint32_t mask);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHIP_H_ */
@@ -0,0 +1,73 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+/** @file host_serial.h
+ ** @brief Transporte serie simulado en el host para las cadenas de pantallas.
+ ** @details Reemplaza al periférico SPI o a la implementación por software, cuenta los bits desplazados y los pulsos
+ ** de carga y guarda el último bloque enviado para que las pruebas puedan medir el costo de cada actualización.
+ **/
+
+#ifndef HOST_SERIAL_H_
+#define HOST_SERIAL_H_
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "serial_screen.h"
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Estado del transporte simulado.
+ */
+typedef struct host_serial_s {
+    uint32_t bits;                           // Bits desplazados desde el último reinicio
+    uint32_t latches;                        // Pulsos de carga generados desde el último reinicio
+    uint32_t calls;                          // Bloques recibidos desde el último reinicio
+    uint16_t size;                           // Bytes del último bloque
+    uint8_t data[SERIAL_SCREEN_BUFFER_SIZE]; // Contenido del último bloque
+} host_serial_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Recibe un bloque de tramas, con la forma de serial_send_t.
+ * @param object Estado del transporte simulado, de tipo host_serial_t.
+ */
+void HostSerialSend(void * object, const uint8_t * data, uint16_t size, uint16_t frame_size);
+
+/**
+ * @brief Pone en cero los contadores del transporte simulado.
+ */
+void HostSerialReset(host_serial_t * serial);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SERIAL_H_ */
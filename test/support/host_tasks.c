@@ -0,0 +1,200 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file host_tasks.c
+ ** @brief Implementación de las tareas del host con hilos POSIX.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _XOPEN_SOURCE 600 // Necesario para pthread, señales y temporizadores con -std=c99
+
+#include "host_tasks.h"
+#include <pthread.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Private macros definitions ================================================================================== */
+
+#define WATCHDOG_PERIOD_US 10000 // Período con que se controla el tiempo de procesador de la tarea que desaloja
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Datos de una tarea en ejecución.
+ */
+typedef struct {
+    pthread_t thread;
+    host_task_t task;
+    void * argument;
+} host_task_s;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Adapta la función de la tarea a la firma que esperan los hilos POSIX.
+ */
+static void * TaskEntry(void * object);
+
+/**
+ * @brief Ejecuta la tarea que desaloja, contando su tiempo de procesador desde cero.
+ */
+static void PreemptRun(void);
+
+/**
+ * @brief Atiende el temporizador de la tarea que desaloja, la ejecuta o la deja pendiente si el desalojo está impedido.
+ */
+static void PreemptHandler(int signal);
+
+/**
+ * @brief Aborta la prueba si la tarea que desaloja lleva más de HOST_PREEMPT_TIMEOUT_MS ejecutándose.
+ */
+static void WatchdogHandler(int signal);
+
+/* === Private variable definitions ================================================================================ */
+
+static host_task_s tasks[HOST_TASKS_MAX];
+static int task_count;
+
+static host_task_t preempt_task;
+static void * preempt_argument;
+static volatile sig_atomic_t scheduler_suspended; // Cantidad de llamadas a HostSchedulerSuspend sin su Resume
+static volatile sig_atomic_t preempt_pending;     // La tarea se despertó mientras el desalojo estaba impedido
+static volatile sig_atomic_t preempt_running;     // La tarea que desaloja se está ejecutando
+static volatile sig_atomic_t preempt_ticks;       // Períodos del control que lleva ejecutándose la tarea
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void * TaskEntry(void * object) {
+    host_task_s * self = object;
+    self->task(self->argument);
+    return NULL;
+}
+
+static void PreemptRun(void) {
+    preempt_ticks = 0;
+    preempt_running = 1;
+    preempt_task(preempt_argument);
+    preempt_running = 0;
+}
+
+static void PreemptHandler(int signal) {
+    (void)signal;
+
+    if (scheduler_suspended) {
+        preempt_pending = 1;
+    } else {
+        PreemptRun();
+    }
+}
+
+static void WatchdogHandler(int signal) {
+    static const char message[] = "La tarea que desaloja quedo esperando a la tarea interrumpida\n";
+    (void)signal;
+
+    if (preempt_running && ++preempt_ticks > HOST_PREEMPT_TIMEOUT_MS * 1000 / WATCHDOG_PERIOD_US) {
+        (void)write(STDERR_FILENO, message, sizeof(message) - 1);
+        _exit(1);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+bool HostTaskStart(host_task_t task, void * argument) {
+    if (task_count == HOST_TASKS_MAX) {
+        return false;
+    }
+
+    host_task_s * self = &tasks[task_count];
+    self->task = task;
+    self->argument = argument;
+    if (pthread_create(&self->thread, NULL, TaskEntry, self) != 0) {
+        return false;
+    }
+    task_count++;
+    return true;
+}
+
+void HostTasksJoin(void) {
+    for (int index = 0; index < task_count; index++) {
+        pthread_join(tasks[index].thread, NULL);
+    }
+    task_count = 0;
+}
+
+void HostSleep(uint32_t microseconds) {
+    struct timespec delay = {.tv_sec = microseconds / 1000000, .tv_nsec = (long)(microseconds % 1000000) * 1000};
+    nanosleep(&delay, NULL);
+}
+
+bool HostPreemptStart(host_task_t task, void * argument, uint32_t period) {
+    struct sigaction preempt = {.sa_handler = PreemptHandler, .sa_flags = SA_RESTART};
+    struct sigaction watchdog = {.sa_handler = WatchdogHandler, .sa_flags = SA_RESTART};
+    struct itimerval preempt_timer = {
+        .it_interval = {.tv_sec = period / 1000000, .tv_usec = period % 1000000},
+        .it_value = {.tv_sec = period / 1000000, .tv_usec = period % 1000000},
+    };
+    struct itimerval watchdog_timer = {
+        .it_interval = {.tv_usec = WATCHDOG_PERIOD_US},
+        .it_value = {.tv_usec = WATCHDOG_PERIOD_US},
+    };
+
+    preempt_task = task;
+    preempt_argument = argument;
+    scheduler_suspended = 0;
+    preempt_pending = 0;
+    sigemptyset(&preempt.sa_mask);
+    sigemptyset(&watchdog.sa_mask);
+    if (sigaction(SIGALRM, &preempt, NULL) != 0 || sigaction(SIGPROF, &watchdog, NULL) != 0) {
+        return false;
+    }
+    return setitimer(ITIMER_PROF, &watchdog_timer, NULL) == 0 && setitimer(ITIMER_REAL, &preempt_timer, NULL) == 0;
+}
+
+void HostPreemptStop(void) {
+    struct itimerval stopped = {0};
+
+    setitimer(ITIMER_REAL, &stopped, NULL);
+    setitimer(ITIMER_PROF, &stopped, NULL);
+    preempt_pending = 0;
+}
+
+void HostSchedulerSuspend(void) {
+    scheduler_suspended++;
+}
+
+void HostSchedulerResume(void) {
+    sigset_t preempt;
+    sigset_t previous;
+
+    // Mientras se ejecuta la tarea pendiente se bloquea el temporizador, como si la tarea tuviera el procesador
+    sigemptyset(&preempt);
+    sigaddset(&preempt, SIGALRM);
+    pthread_sigmask(SIG_BLOCK, &preempt, &previous);
+    if (--scheduler_suspended == 0 && preempt_pending) {
+        preempt_pending = 0;
+        PreemptRun();
+    }
+    pthread_sigmask(SIG_SETMASK, &previous, NULL);
+}
+
+/* === End of conditional blocks =================================================================================== */
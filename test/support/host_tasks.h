@@ -0,0 +1,114 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file host_tasks.h
+ ** @brief Tareas concurrentes en el host para las pruebas de concurrencia.
+ ** @details Se implementan en un archivo aparte porque las cabeceras de hilos del host incluyen time.h, cuyo clock_t
+ ** choca con el del reloj.
+ **/
+
+#ifndef HOST_TASKS_H_
+#define HOST_TASKS_H_
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define HOST_TASKS_MAX 8 // Cantidad maxima de tareas que se pueden ejecutar al mismo tiempo
+
+#define HOST_PREEMPT_TIMEOUT_MS 1000 // Tiempo maximo de procesador que puede usar una tarea que desaloja a otra
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Función que ejecuta una tarea del host.
+ */
+typedef void (*host_task_t)(void * argument);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Inicia una tarea que se ejecuta en paralelo con el resto, con desalojo como en el sistema operativo.
+ *
+ * @param task Función que ejecuta la tarea.
+ * @param argument Argumento que recibe la función.
+ * @return true si la tarea se inició, false si no se pudo crear o ya hay HOST_TASKS_MAX tareas en ejecución.
+ */
+bool HostTaskStart(host_task_t task, void * argument);
+
+/**
+ * @brief Espera a que terminen todas las tareas iniciadas.
+ */
+void HostTasksJoin(void);
+
+/**
+ * @brief Suspende la tarea que la llama durante el tiempo indicado.
+ *
+ * @param microseconds Tiempo de espera en microsegundos.
+ */
+void HostSleep(uint32_t microseconds);
+
+/**
+ * @brief Ejecuta una tarea en forma periódica desalojando a la que está en ejecución en el hilo principal.
+ *
+ * Simula con un solo núcleo una tarea de mayor prioridad que se despierta mientras la prueba se ejecuta: la tarea
+ * interrumpida no continúa hasta que la que desaloja termina. Si esta no termina en HOST_PREEMPT_TIMEOUT_MS de
+ * procesador se considera que espera algo que solo puede hacer la tarea interrumpida y se aborta la prueba.
+ *
+ * @param task Función que ejecuta la tarea, no debe esperar ni dormir.
+ * @param argument Argumento que recibe la función.
+ * @param period Período de activación en microsegundos.
+ * @return true si se inició el temporizador, false si no se pudo configurar.
+ */
+bool HostPreemptStart(host_task_t task, void * argument, uint32_t period);
+
+/**
+ * @brief Detiene la tarea iniciada con HostPreemptStart.
+ */
+void HostPreemptStop(void);
+
+/**
+ * @brief Impide que la tarea iniciada con HostPreemptStart desaloje a la actual, como vTaskSuspendAll.
+ */
+void HostSchedulerSuspend(void);
+
+/**
+ * @brief Permite nuevamente el desalojo y ejecuta la tarea si se despertó mientras estaba impedido.
+ *
+ * Equivale a xTaskResumeAll: la tarea pendiente se ejecuta antes de volver a la que llama.
+ */
+void HostSchedulerResume(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_TASKS_H_ */
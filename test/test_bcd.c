@@ -0,0 +1,146 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_bcd.c
+ ** @brief Pruebas de la aritmética BCD sobre palabras de 64 bits.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "bcd.h"
+
+/* === Private macros definitions ================================================================================ */
+
+// Arma una palabra BCD a partir de los dígitos en el orden en que se leen, HH:MM:SS
+#define BCD_TIME(ht, hu, mt, mu, st, su)                                                                              \
+    (((bcd_word_t)(ht) << 40) | ((bcd_word_t)(hu) << 32) | ((bcd_word_t)(mt) << 24) | ((bcd_word_t)(mu) << 16) |       \
+     ((bcd_word_t)(st) << 8) | (bcd_word_t)(su))
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Convierte una palabra BCD válida a segundos desde las 00:00:00.
+ */
+static uint32_t WordToSeconds(bcd_word_t word);
+
+/**
+ * @brief Convierte segundos desde las 00:00:00 a una palabra BCD.
+ */
+static bcd_word_t SecondsToWord(uint32_t seconds);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t WordToSeconds(bcd_word_t word) {
+    uint32_t minutes = ((word >> 24) & 0xFF) * 10 + ((word >> 16) & 0xFF);
+    uint32_t seconds = ((word >> 8) & 0xFF) * 10 + (word & 0xFF);
+    return BcdHours(word) * 3600 + minutes * 60 + seconds;
+}
+
+static bcd_word_t SecondsToWord(uint32_t seconds) {
+    uint32_t hours = seconds / 3600;
+    uint32_t minutes = (seconds / 60) % 60;
+    seconds = seconds % 60;
+    return BCD_TIME(hours / 10, hours % 10, minutes / 10, minutes % 10, seconds / 10, seconds % 10);
+}
+
+/* === Public function implementation ========================================================= */
+
+// La palabra mantiene el orden de los digitos de clock_time_t
+void test_load_and_store(void) {
+    clock_time_t time = {.time = {.seconds = {8, 5}, .minutes = {4, 3}, .hours = {1, 2}}};
+    clock_time_t copy;
+
+    bcd_word_t word = BcdLoad(&time);
+    TEST_ASSERT_TRUE(word == BCD_TIME(2, 1, 3, 4, 5, 8));
+    BcdStore(word, &copy);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(time.bcd, copy.bcd, sizeof(time.bcd));
+}
+
+// Se rechazan los digitos fuera de rango y las horas mayores a 23
+void test_validate(void) {
+    TEST_ASSERT_TRUE(BcdIsValid(BCD_TIME(0, 0, 0, 0, 0, 0)));
+    TEST_ASSERT_TRUE(BcdIsValid(BCD_TIME(2, 3, 5, 9, 5, 9)));
+    TEST_ASSERT_TRUE(BcdIsValid(BCD_TIME(1, 9, 0, 0, 0, 0)));
+    TEST_ASSERT_FALSE(BcdIsValid(BCD_TIME(0, 0, 0, 0, 0, 10)));
+    TEST_ASSERT_FALSE(BcdIsValid(BCD_TIME(0, 0, 0, 0, 6, 0)));
+    TEST_ASSERT_FALSE(BcdIsValid(BCD_TIME(0, 0, 0, 10, 0, 0)));
+    TEST_ASSERT_FALSE(BcdIsValid(BCD_TIME(0, 0, 6, 0, 0, 0)));
+    TEST_ASSERT_FALSE(BcdIsValid(BCD_TIME(2, 4, 0, 0, 0, 0)));
+    TEST_ASSERT_FALSE(BcdIsValid(BCD_TIME(3, 0, 0, 0, 0, 0)));
+    TEST_ASSERT_FALSE(BcdIsValid(BCD_TIME(0, 10, 0, 0, 0, 0)));
+    TEST_ASSERT_FALSE(BcdIsValid(BCD_TIME(0, 0, 0, 0, 0, 0xF0)));
+    TEST_ASSERT_FALSE(BcdIsValid(BCD_TIME(0, 0, 0, 0, 0, 0) | (1ULL << 48)));
+}
+
+// El orden de las palabras es el mismo que el de las horas
+void test_compare(void) {
+    TEST_ASSERT_EQUAL(0, BcdCompare(BCD_TIME(1, 2, 3, 4, 5, 6), BCD_TIME(1, 2, 3, 4, 5, 6)));
+    TEST_ASSERT_LESS_THAN(0, BcdCompare(BCD_TIME(0, 9, 5, 9, 5, 9), BCD_TIME(1, 0, 0, 0, 0, 0)));
+    TEST_ASSERT_GREATER_THAN(0, BcdCompare(BCD_TIME(2, 3, 0, 0, 0, 0), BCD_TIME(2, 2, 5, 9, 5, 9)));
+}
+
+// La suma propaga los acarreos por todos los digitos y da la vuelta a las 24 horas
+void test_add_with_carries(void) {
+    TEST_ASSERT_TRUE(BcdAdd(BCD_TIME(1, 2, 5, 9, 5, 9), BCD_ONE_SECOND) == BCD_TIME(1, 3, 0, 0, 0, 0));
+    TEST_ASSERT_TRUE(BcdAdd(BCD_TIME(2, 3, 5, 9, 5, 9), BCD_ONE_SECOND) == BCD_TIME(0, 0, 0, 0, 0, 0));
+    TEST_ASSERT_TRUE(BcdAdd(BCD_TIME(1, 9, 5, 5, 0, 0), BCD_TIME(0, 4, 0, 5, 0, 0)) == BCD_TIME(0, 0, 0, 0, 0, 0));
+    TEST_ASSERT_TRUE(BcdAdd(BCD_TIME(2, 3, 5, 9, 5, 9), BCD_TIME(2, 3, 5, 9, 5, 9)) == BCD_TIME(2, 3, 5, 9, 5, 8));
+}
+
+// La resta toma prestado de los digitos siguientes y da la vuelta antes de las 00:00:00
+void test_subtract_with_borrows(void) {
+    TEST_ASSERT_TRUE(BcdSubtract(BCD_TIME(1, 3, 0, 0, 0, 0), BCD_ONE_SECOND) == BCD_TIME(1, 2, 5, 9, 5, 9));
+    TEST_ASSERT_TRUE(BcdSubtract(BCD_TIME(0, 0, 0, 0, 0, 0), BCD_ONE_SECOND) == BCD_TIME(2, 3, 5, 9, 5, 9));
+    TEST_ASSERT_TRUE(BcdSubtract(BCD_TIME(0, 7, 0, 0, 0, 0), BCD_TIME(0, 7, 0, 0, 0, 0)) == 0);
+}
+
+// Sumar o restar en un campo da la vuelta dentro del campo sin modificar los otros
+void test_field_arithmetic(void) {
+    TEST_ASSERT_TRUE(BcdAddField(BCD_TIME(1, 2, 5, 9, 3, 0), BCD_ONE_MINUTE, BCD_MINUTES) ==
+                     BCD_TIME(1, 2, 0, 0, 3, 0));
+    TEST_ASSERT_TRUE(BcdSubtractField(BCD_TIME(1, 2, 0, 0, 3, 0), BCD_ONE_MINUTE, BCD_MINUTES) ==
+                     BCD_TIME(1, 2, 5, 9, 3, 0));
+    TEST_ASSERT_TRUE(BcdAddField(BCD_TIME(2, 3, 5, 9, 0, 0), BCD_ONE_HOUR, BCD_HOURS) == BCD_TIME(0, 0, 5, 9, 0, 0));
+    TEST_ASSERT_TRUE(BcdSubtractField(BCD_TIME(0, 0, 1, 5, 0, 0), BCD_ONE_HOUR, BCD_HOURS) ==
+                     BCD_TIME(2, 3, 1, 5, 0, 0));
+}
+
+// La suma y la resta coinciden con la aritmetica binaria para todas las horas del dia
+void test_matches_binary_arithmetic(void) {
+    static const uint32_t deltas[] = {1, 59, 60, 61, 3599, 3600, 43200, 86399};
+
+    for (uint32_t seconds = 0; seconds < 86400; seconds += 7) {
+        bcd_word_t word = SecondsToWord(seconds);
+        TEST_ASSERT_TRUE(BcdIsValid(word));
+        for (uint32_t index = 0; index < sizeof(deltas) / sizeof(deltas[0]); index++) {
+            bcd_word_t delta = SecondsToWord(deltas[index]);
+            TEST_ASSERT_EQUAL_UINT32((seconds + deltas[index]) % 86400, WordToSeconds(BcdAdd(word, delta)));
+            TEST_ASSERT_EQUAL_UINT32((seconds + 86400 - deltas[index]) % 86400,
+                                     WordToSeconds(BcdSubtract(word, delta)));
+        }
+    }
+}
+
+/* === End of conditional blocks =================================================================================== */
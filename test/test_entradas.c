@@ -0,0 +1,226 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_entradas.c
+ ** @brief Pruebas de los grupos de entradas digitales que se muestrean por puerto.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "digital.h"
+#include "chip.h"
+
+/* === Private macros definitions ================================================================================ */
+
+#define TEST_GPIO   5 // Puerto de las teclas del poncho
+#define TEST_KEYS   6 // Teclas del poncho, todas en el mismo puerto
+#define OTHER_GPIO  3 // Puerto de una entrada adicional
+#define THIRD_GPIO  1 // Puerto que ya no entra en el grupo
+#define TEST_FIRST  8 // Terminal de la primera tecla
+#define TEST_DEPTH  4 // Muestras que tiene que durar un cambio en las pruebas del antirrebote
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Cambia el terminal de una tecla, que es de lógica invertida.
+ */
+static void Press(uint8_t bit, bool pressed);
+
+/**
+ * @brief Muestrea el grupo siguiendo la forma de onda de una tecla y anota los flancos que entrega el grupo.
+ * @param wave Nivel de la tecla en cada muestra, '1' presionada y '0' suelta.
+ * @param edges Flanco en cada muestra, '+' al activarse, '-' al desactivarse y '.' sin cambios.
+ */
+static void Feed(uint8_t key, const char * wave, char * edges);
+
+/* === Private variable definitions ================================================================================ */
+
+static digital_input_storage_t storages[TEST_KEYS + 1];
+static digital_input_t keys[TEST_KEYS];
+static digital_input_t other;
+static digital_input_group_storage_t group_storage;
+static digital_input_group_t group;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Press(uint8_t bit, bool pressed) {
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, TEST_GPIO, bit, !pressed);
+}
+
+static void Feed(uint8_t key, const char * wave, char * edges) {
+    digital_keys_t mask = DigitalInputGroupKey(group, keys[key]);
+
+    for (; *wave; wave++, edges++) {
+        Press(TEST_FIRST + key, *wave == '1');
+        DigitalInputGroupScan(group);
+        *edges = '.';
+        if (DigitalInputGroupActivated(group) & mask) {
+            *edges = '+';
+        } else if (DigitalInputGroupDeactivated(group) & mask) {
+            *edges = '-';
+        }
+    }
+    *edges = 0;
+}
+
+/* === Public function definitions ================================================================================= */
+
+void setUp(void) {
+    HostGpioReset();
+    host_gpio.PIN[TEST_GPIO] = 0xFFFFFFFF; // Teclas sueltas
+    group = DigitalInputGroupCreateStatic(&group_storage);
+
+    for (uint8_t i = 0; i < TEST_KEYS; i++) {
+        keys[i] = DigitalInputCreateStatic(&storages[i], TEST_GPIO, TEST_FIRST + i, true);
+        TEST_ASSERT_NOT_EQUAL(0, DigitalInputGroupAdd(group, keys[i]));
+    }
+    other = DigitalInputCreateStatic(&storages[TEST_KEYS], OTHER_GPIO, TEST_FIRST, false);
+    TEST_ASSERT_NOT_EQUAL(0, DigitalInputGroupAdd(group, other));
+}
+
+// Cada muestreo lee una sola vez cada puerto, sin importar cuántas entradas tenga el grupo
+void test_scan_reads_each_port_once(void) {
+    host_gpio_port_reads = 0;
+    DigitalInputGroupScan(group);
+    TEST_ASSERT_EQUAL_UINT32(2, host_gpio_port_reads);
+}
+
+// Las entradas de distintos puertos tienen máscaras distintas aunque usen el mismo terminal
+void test_keys_of_different_ports_do_not_overlap(void) {
+    digital_keys_t key = DigitalInputGroupKey(group, keys[0]);
+
+    TEST_ASSERT_NOT_EQUAL(0, key);
+    TEST_ASSERT_TRUE((key & DigitalInputGroupKey(group, other)) == 0);
+}
+
+// Los flancos se detectan para todas las teclas a la vez y duran hasta el siguiente muestreo
+void test_edges_of_several_keys(void) {
+    digital_keys_t first = DigitalInputGroupKey(group, keys[0]);
+    digital_keys_t last = DigitalInputGroupKey(group, keys[TEST_KEYS - 1]);
+
+    Press(TEST_FIRST, true);
+    Press(TEST_FIRST + TEST_KEYS - 1, true);
+    DigitalInputGroupScan(group);
+    TEST_ASSERT_TRUE(DigitalInputGroupActivated(group) == (first | last));
+    TEST_ASSERT_TRUE(DigitalInputGroupActive(group) == (first | last));
+    TEST_ASSERT_TRUE(DigitalInputGroupDeactivated(group) == 0);
+
+    Press(TEST_FIRST, false);
+    DigitalInputGroupScan(group);
+    TEST_ASSERT_TRUE(DigitalInputGroupActivated(group) == 0);
+    TEST_ASSERT_TRUE(DigitalInputGroupDeactivated(group) == first);
+
+    DigitalInputGroupScan(group);
+    TEST_ASSERT_TRUE(DigitalInputGroupDeactivated(group) == 0);
+}
+
+// Consultar un flanco no lo consume, solo lo hace DigitalInputGroupConsume con las teclas indicadas
+void test_edges_are_consumed_explicitly(void) {
+    digital_keys_t first = DigitalInputGroupKey(group, keys[0]);
+    digital_keys_t second = DigitalInputGroupKey(group, keys[1]);
+
+    Press(TEST_FIRST, true);
+    Press(TEST_FIRST + 1, true);
+    DigitalInputGroupScan(group);
+    Press(TEST_FIRST, false);
+    Press(TEST_FIRST + 1, false);
+    DigitalInputGroupScan(group);
+
+    TEST_ASSERT_TRUE(DigitalInputGroupDeactivated(group) & first);
+    TEST_ASSERT_TRUE(DigitalInputGroupDeactivated(group) & first);
+
+    DigitalInputGroupConsume(group, first);
+    TEST_ASSERT_TRUE(DigitalInputGroupDeactivated(group) == second);
+}
+
+// Un grupo no acepta entradas de más puertos de los que puede leer
+void test_group_rejects_third_port(void) {
+    static digital_input_storage_t storage;
+    digital_input_t input = DigitalInputCreateStatic(&storage, THIRD_GPIO, 0, false);
+
+    TEST_ASSERT_TRUE(DigitalInputGroupAdd(group, input) == 0);
+    TEST_ASSERT_TRUE(DigitalInputGroupKey(group, input) == 0);
+}
+
+// Los rebotes al presionar y al soltar una tecla entregan un solo flanco en cada caso
+void test_debounce_bouncing_press_and_release(void) {
+    char edges[32];
+
+    TEST_ASSERT_TRUE(DigitalInputGroupSetDebounce(group, TEST_DEPTH));
+    Feed(0, "0101101111111010010000000", edges);
+    TEST_ASSERT_EQUAL_STRING(".........+...........-...", edges);
+}
+
+// Un pulso más corto que el filtro no produce flancos
+void test_debounce_ignores_short_glitches(void) {
+    char edges[32];
+
+    TEST_ASSERT_TRUE(DigitalInputGroupSetDebounce(group, TEST_DEPTH));
+    Feed(2, "0011101110011100000", edges);
+    TEST_ASSERT_EQUAL_STRING("...................", edges);
+}
+
+// Las teclas se filtran a la vez, cada una con su propio contador
+void test_debounce_keys_independently(void) {
+    static const char * waves[] = {"1111111111", "1010111111", "1111000000"};
+    digital_keys_t activated[10] = {0};
+
+    TEST_ASSERT_TRUE(DigitalInputGroupSetDebounce(group, TEST_DEPTH));
+    for (uint8_t sample = 0; sample < 10; sample++) {
+        for (uint8_t key = 0; key < 3; key++) {
+            Press(TEST_FIRST + key, waves[key][sample] == '1');
+        }
+        DigitalInputGroupScan(group);
+        activated[sample] = DigitalInputGroupActivated(group);
+    }
+    TEST_ASSERT_TRUE(activated[3] == (DigitalInputGroupKey(group, keys[0]) | DigitalInputGroupKey(group, keys[2])));
+    TEST_ASSERT_TRUE(activated[7] == DigitalInputGroupKey(group, keys[1]));
+    TEST_ASSERT_TRUE(DigitalInputGroupActive(group) == (DigitalInputGroupKey(group, keys[0]) | activated[7]));
+}
+
+// El filtro no acepta más muestras de las que pueden contar sus contadores
+void test_debounce_depth_out_of_range(void) {
+    TEST_ASSERT_FALSE(DigitalInputGroupSetDebounce(group, 0));
+    TEST_ASSERT_FALSE(DigitalInputGroupSetDebounce(group, DIGITAL_DEBOUNCE_MAX_SAMPLES + 1));
+    TEST_ASSERT_TRUE(DigitalInputGroupSetDebounce(group, DIGITAL_DEBOUNCE_MAX_SAMPLES));
+}
+
+// El grupo solo está quieto cuando las lecturas coinciden con el estado filtrado y no hay cambios en curso
+void test_group_settles_after_debounce(void) {
+    TEST_ASSERT_TRUE(DigitalInputGroupSetDebounce(group, TEST_DEPTH));
+    TEST_ASSERT_TRUE(DigitalInputGroupIsSettled(group));
+
+    Press(TEST_FIRST, true);
+    TEST_ASSERT_FALSE(DigitalInputGroupIsSettled(group));
+    for (uint8_t sample = 1; sample < TEST_DEPTH; sample++) {
+        DigitalInputGroupScan(group);
+    }
+    Press(TEST_FIRST, false);
+    TEST_ASSERT_FALSE(DigitalInputGroupIsSettled(group));
+
+    DigitalInputGroupScan(group);
+    TEST_ASSERT_TRUE(DigitalInputGroupIsSettled(group));
+    TEST_ASSERT_TRUE(DigitalInputGroupActive(group) == 0);
+}
+
+/* === End of conditional blocks =================================================================================== */
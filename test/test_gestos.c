@@ -0,0 +1,170 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_gestos.c
+ ** @brief Pruebas del reconocedor de gestos de las teclas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "digital.h"
+#include "chip.h" // El módulo digital también maneja terminales, se enlaza con el chip simulado
+
+/* === Private macros definitions ================================================================================ */
+
+#define KEY_PLAIN  ((digital_keys_t)1 << 3)  // Tecla con presión corta y larga
+#define KEY_DOUBLE ((digital_keys_t)1 << 35) // Tecla con doble presión, en el segundo puerto
+#define KEY_REPEAT ((digital_keys_t)1 << 7)  // Tecla que repite al mantenerla
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Mantiene las teclas indicadas durante un tiempo, actualizando el reconocedor en cada unidad de tiempo.
+ */
+static void Hold(digital_keys_t pressed, uint32_t duration);
+
+/**
+ * @brief Verifica que el próximo gesto de la cola sea el indicado.
+ */
+static void AssertGesture(digital_keys_t key, digital_gesture_kind_t kind);
+
+/* === Private variable definitions ================================================================================ */
+
+static const digital_gestures_timing_t timing = {
+    .long_press = 3000,
+    .double_press = 300,
+    .repeat_delay = 500,
+    .repeat_period = 200,
+    .repeat_min = 25,
+};
+
+static digital_gestures_storage_t storage;
+static digital_gestures_t gestures;
+static uint32_t now;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Hold(digital_keys_t pressed, uint32_t duration) {
+    for (uint32_t tick = 0; tick < duration; tick++) {
+        DigitalGesturesUpdate(gestures, pressed, now++);
+    }
+}
+
+static void AssertGesture(digital_keys_t key, digital_gesture_kind_t kind) {
+    digital_gesture_t gesture;
+
+    TEST_ASSERT_TRUE(DigitalGesturesNext(gestures, &gesture));
+    TEST_ASSERT_TRUE(gesture.key == key);
+    TEST_ASSERT_EQUAL(kind, gesture.kind);
+}
+
+/* === Public function definitions ================================================================================= */
+
+void setUp(void) {
+    now = 65000; // Cerca del desborde de los 16 bits de las marcas
+    gestures = DigitalGesturesCreateStatic(&storage, &timing);
+    TEST_ASSERT_TRUE(DigitalGesturesAdd(gestures, KEY_PLAIN, 0));
+    TEST_ASSERT_TRUE(DigitalGesturesAdd(gestures, KEY_DOUBLE, DIGITAL_GESTURE_OPTION_DOUBLE));
+    TEST_ASSERT_TRUE(DigitalGesturesAdd(gestures, KEY_REPEAT, DIGITAL_GESTURE_OPTION_REPEAT));
+}
+
+// Una presión corta se entrega al soltar la tecla
+void test_short_press(void) {
+    digital_gesture_t gesture;
+
+    Hold(KEY_PLAIN, 100);
+    TEST_ASSERT_FALSE(DigitalGesturesNext(gestures, &gesture));
+    Hold(0, 1);
+    AssertGesture(KEY_PLAIN, DIGITAL_GESTURE_PRESS);
+    TEST_ASSERT_FALSE(DigitalGesturesNext(gestures, &gesture));
+}
+
+// La presión larga se entrega sin esperar a soltar, y soltar después no agrega una presión corta
+void test_long_press(void) {
+    digital_gesture_t gesture;
+
+    Hold(KEY_PLAIN, 3000);
+    TEST_ASSERT_FALSE(DigitalGesturesNext(gestures, &gesture));
+    Hold(KEY_PLAIN, 1);
+    AssertGesture(KEY_PLAIN, DIGITAL_GESTURE_LONG_PRESS);
+    TEST_ASSERT_TRUE(DigitalGesturesIsIdle(gestures));
+
+    Hold(0, 10);
+    TEST_ASSERT_FALSE(DigitalGesturesNext(gestures, &gesture));
+}
+
+// Dos presiones dentro de la ventana forman una doble presión, una sola se entrega al cerrar la ventana
+void test_double_press(void) {
+    digital_gesture_t gesture;
+
+    Hold(KEY_DOUBLE, 50);
+    Hold(0, 100);
+    TEST_ASSERT_FALSE(DigitalGesturesNext(gestures, &gesture));
+    Hold(KEY_DOUBLE, 1);
+    AssertGesture(KEY_DOUBLE, DIGITAL_GESTURE_DOUBLE_PRESS);
+    Hold(KEY_DOUBLE, 50);
+    Hold(0, 10);
+    TEST_ASSERT_FALSE(DigitalGesturesNext(gestures, &gesture));
+
+    Hold(KEY_DOUBLE, 50);
+    Hold(0, 300);
+    TEST_ASSERT_FALSE(DigitalGesturesIsIdle(gestures));
+    Hold(0, 1);
+    AssertGesture(KEY_DOUBLE, DIGITAL_GESTURE_PRESS);
+    TEST_ASSERT_TRUE(DigitalGesturesIsIdle(gestures));
+}
+
+// Mantener la tecla repite cada vez más rápido hasta el intervalo mínimo
+void test_repeat_accelerates(void) {
+    digital_gesture_t gesture;
+    uint32_t times[64];
+    uint8_t count = 0;
+
+    for (uint32_t tick = 0; tick < 3000; tick++) {
+        Hold(KEY_REPEAT, 1);
+        while (DigitalGesturesNext(gestures, &gesture)) {
+            TEST_ASSERT_EQUAL(DIGITAL_GESTURE_REPEAT, gesture.kind);
+            TEST_ASSERT_LESS_THAN(64, count);
+            times[count++] = tick;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(500, times[0]);
+    TEST_ASSERT_EQUAL_UINT32(200, times[1] - times[0]);
+    TEST_ASSERT_EQUAL_UINT32(175, times[2] - times[1]);
+    TEST_ASSERT_EQUAL_UINT32(25, times[count - 1] - times[count - 2]);
+    TEST_ASSERT_GREATER_OR_EQUAL(59, count); // De 00 a 59 en menos de tres segundos
+    TEST_ASSERT_FALSE(DigitalGesturesIsIdle(gestures));
+
+    Hold(0, 1);
+    TEST_ASSERT_FALSE(DigitalGesturesNext(gestures, &gesture));
+    TEST_ASSERT_TRUE(DigitalGesturesIsIdle(gestures));
+}
+
+// Una presión corta de una tecla que repite se entrega al soltar
+void test_repeat_key_short_press(void) {
+    Hold(KEY_REPEAT, 100);
+    Hold(0, 1);
+    AssertGesture(KEY_REPEAT, DIGITAL_GESTURE_PRESS);
+}
+
+/* === End of conditional blocks =================================================================================== */
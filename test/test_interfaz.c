@@ -0,0 +1,265 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_interfaz.c
+ ** @brief Pruebas de la máquina de estados de la interfaz de usuario, sin sistema operativo.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "ui.h"
+#include "clock.h"
+#include "screen.h"
+#include "digital.h"
+#include "chip.h" // Los indicadores son salidas digitales, se enlaza con el chip simulado
+
+/* === Private macros definitions ================================================================================ */
+
+#define RGB_GPIO    0  // Puerto de los colores del LED, como en el poncho
+#define RED_BIT     11 // Terminal del rojo
+#define GREEN_BIT   12 // Terminal del verde
+#define BLUE_BIT    10 // Terminal del azul
+#define BUZZER_GPIO 5  // Puerto del zumbador
+#define BUZZER_BIT  2  // Terminal del zumbador
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void DigitsTurnOff(void);
+
+static void SegmentsUpdate(uint8_t segments);
+
+static void DigitTurnOn(uint8_t digit);
+
+/**
+ * @brief Entrega el mismo evento a la interfaz la cantidad de veces indicada.
+ */
+static void Send(ui_event_t event, uint8_t times);
+
+/**
+ * @brief Ajusta la hora en 00:00 desde las teclas, dejando la interfaz en MODE_HOME.
+ */
+static void GoHome(void);
+
+/**
+ * @brief Verifica que el reloj tenga la hora indicada, en horas y minutos BCD.
+ */
+static void AssertTime(const clock_time_t * time, uint8_t hours, uint8_t minutes);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s driver = {
+    .DigitsTurnOff = DigitsTurnOff,
+    .SegmentsUpdate = SegmentsUpdate,
+    .DigitTurnOn = DigitTurnOn,
+};
+
+static digital_output_storage_t output_storages[4];
+static digital_output_group_storage_t group_storage;
+static screen_storage_t screen_storage;
+static clock_storage_t clock_storage;
+static ui_storage_t ui_storage;
+
+static struct Board_s board;
+static clock_t clock;
+static ui_t ui;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void DigitsTurnOff(void) {
+}
+
+static void SegmentsUpdate(uint8_t segments) {
+    (void)segments;
+}
+
+static void DigitTurnOn(uint8_t digit) {
+    (void)digit;
+}
+
+static void Send(ui_event_t event, uint8_t times) {
+    for (uint8_t index = 0; index < times; index++) {
+        UiHandleEvent(ui, event);
+    }
+}
+
+static void GoHome(void) {
+    Send(UI_EVENT_SET_TIME, 1);
+    Send(UI_EVENT_ACCEPT, 2);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+}
+
+static void AssertTime(const clock_time_t * time, uint8_t hours, uint8_t minutes) {
+    TEST_ASSERT_EQUAL_UINT8(hours >> 4, time->time.hours[1]);
+    TEST_ASSERT_EQUAL_UINT8(hours & 0x0F, time->time.hours[0]);
+    TEST_ASSERT_EQUAL_UINT8(minutes >> 4, time->time.minutes[1]);
+    TEST_ASSERT_EQUAL_UINT8(minutes & 0x0F, time->time.minutes[0]);
+}
+
+/* === Public function definitions ================================================================================= */
+
+void setUp(void) {
+    HostGpioReset();
+    board.screen = ScreenCreateStatic(&screen_storage, 4, 4, &driver);
+    board.led_red = DigitalOutputCreateStatic(&output_storages[0], RGB_GPIO, RED_BIT, true);
+    board.led_green = DigitalOutputCreateStatic(&output_storages[1], RGB_GPIO, GREEN_BIT, true);
+    board.led_blue = DigitalOutputCreateStatic(&output_storages[2], RGB_GPIO, BLUE_BIT, true);
+    board.buzzer = DigitalOutputCreateStatic(&output_storages[3], BUZZER_GPIO, BUZZER_BIT, true);
+
+    // El orden en que se agregan las salidas es el de los bits BOARD_LED_* y BOARD_BUZZER, como en la placa
+    board.indicators = DigitalOutputGroupCreateStatic(&group_storage);
+    DigitalOutputGroupAdd(board.indicators, board.led_red);
+    DigitalOutputGroupAdd(board.indicators, board.led_green);
+    DigitalOutputGroupAdd(board.indicators, board.led_blue);
+    DigitalOutputGroupAdd(board.indicators, board.buzzer);
+    DigitalOutputGroupWrite(board.indicators, BOARD_BUZZER, 0);
+
+    clock = ClockCreateStatic(&clock_storage, 1);
+    ui = UiCreateStatic(&ui_storage, &board, clock);
+}
+
+// Sin la hora ajustada solo se aceptan las presiones largas, los demás eventos no tienen transición y se descartan
+void test_unset_ignores_events_without_transition(void) {
+    TEST_ASSERT_EQUAL(MODE_UNSET, UiGetMode(ui));
+    Send(UI_EVENT_INCREMENT, 1);
+    Send(UI_EVENT_ACCEPT, 1);
+    Send(UI_EVENT_MINUTE, 1);
+    Send(UI_EVENT_ALARM, 1);
+    Send(UI_EVENT_TIMEOUT, 1);
+    Send(UI_EVENT_NONE, 1);
+    TEST_ASSERT_EQUAL(MODE_UNSET, UiGetMode(ui));
+    TEST_ASSERT_FALSE(UiIsEditing(ui));
+}
+
+// La hora se edita por minutos y luego por horas, y se guarda en el reloj al aceptar las horas
+void test_set_time_edits_minutes_then_hours(void) {
+    clock_time_t time;
+
+    Send(UI_EVENT_SET_TIME, 1);
+    TEST_ASSERT_EQUAL(MODE_SET_TIME_MINUTES, UiGetMode(ui));
+    TEST_ASSERT_TRUE(UiIsEditing(ui));
+    Send(UI_EVENT_INCREMENT, 5);
+    Send(UI_EVENT_DECREMENT, 1);
+    Send(UI_EVENT_ACCEPT, 1);
+    TEST_ASSERT_EQUAL(MODE_SET_TIME_HOURS, UiGetMode(ui));
+    Send(UI_EVENT_DECREMENT, 2);
+    Send(UI_EVENT_ACCEPT, 1);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    TEST_ASSERT_FALSE(UiIsEditing(ui));
+
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &time));
+    AssertTime(&time, 0x22, 0x04);
+}
+
+// Cancelar o dejar vencer la edición vuelve al modo desde el que se entró a editar, sin cambiar el reloj
+void test_cancel_and_timeout_return_to_previous_mode(void) {
+    clock_time_t time;
+    clock_time_t before;
+
+    Send(UI_EVENT_SET_ALARM, 1);
+    Send(UI_EVENT_INCREMENT, 1);
+    Send(UI_EVENT_CANCEL, 1);
+    TEST_ASSERT_EQUAL(MODE_UNSET, UiGetMode(ui));
+    TEST_ASSERT_TRUE(ClockGetAlarmTime(clock, &time));
+    AssertTime(&time, 0x00, 0x00);
+
+    GoHome();
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &before));
+    Send(UI_EVENT_SET_TIME, 1);
+    Send(UI_EVENT_ACCEPT, 1);
+    Send(UI_EVENT_INCREMENT, 1);
+    Send(UI_EVENT_TIMEOUT, 1);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &time));
+    TEST_ASSERT_TRUE(ClockTimesMatch(&before, &time));
+}
+
+// La alarma guardada suena con el evento del reloj, enciende el zumbador y al posponerla queda el azul
+void test_alarm_rings_and_snoozes(void) {
+    GoHome();
+    Send(UI_EVENT_SET_ALARM, 1);
+    Send(UI_EVENT_INCREMENT, 1);
+    Send(UI_EVENT_ACCEPT, 2);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    TEST_ASSERT_TRUE(ClockIsAlarmEnabled(clock));
+
+    ClockAdvanceTicks(clock, 60);
+    Send(UI_EVENT_ALARM, 1);
+    TEST_ASSERT_EQUAL(MODE_ALARM_TRIGGERED, UiGetMode(ui));
+    TEST_ASSERT_BIT_HIGH(BUZZER_BIT, host_gpio.PIN[BUZZER_GPIO]);
+    TEST_ASSERT_BIT_LOW(BLUE_BIT, host_gpio.PIN[RGB_GPIO]);
+
+    Send(UI_EVENT_ACCEPT, 1);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_BIT_LOW(BUZZER_BIT, host_gpio.PIN[BUZZER_GPIO]);
+    TEST_ASSERT_BIT_HIGH(BLUE_BIT, host_gpio.PIN[RGB_GPIO]);
+}
+
+// Si la alarma vence mientras se edita, se descarta en ese modo y se atiende al volver al modo normal
+void test_alarm_during_edit_rings_on_return(void) {
+    GoHome();
+    Send(UI_EVENT_SET_ALARM, 1);
+    Send(UI_EVENT_INCREMENT, 1);
+    Send(UI_EVENT_ACCEPT, 2);
+
+    Send(UI_EVENT_SET_TIME, 1);
+    ClockAdvanceTicks(clock, 60);
+    Send(UI_EVENT_ALARM, 1);
+    TEST_ASSERT_EQUAL(MODE_SET_TIME_MINUTES, UiGetMode(ui));
+
+    Send(UI_EVENT_CANCEL, 1);
+    TEST_ASSERT_EQUAL(MODE_ALARM_TRIGGERED, UiGetMode(ui));
+    TEST_ASSERT_BIT_HIGH(BUZZER_BIT, host_gpio.PIN[BUZZER_GPIO]);
+}
+
+// Si el evento de la alarma no llega, por ejemplo con la cola llena, la alarma se atiende con el próximo minuto
+void test_lost_alarm_event_rings_on_next_minute(void) {
+    GoHome();
+    Send(UI_EVENT_SET_ALARM, 1);
+    Send(UI_EVENT_INCREMENT, 1);
+    Send(UI_EVENT_ACCEPT, 2);
+
+    ClockAdvanceTicks(clock, 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+
+    Send(UI_EVENT_MINUTE, 1);
+    TEST_ASSERT_EQUAL(MODE_ALARM_TRIGGERED, UiGetMode(ui));
+    TEST_ASSERT_BIT_HIGH(BUZZER_BIT, host_gpio.PIN[BUZZER_GPIO]);
+}
+
+// La hora de la alarma se puede guardar antes de ajustar la hora, y entonces la interfaz vuelve a MODE_UNSET
+void test_alarm_saved_from_unset_returns_to_unset(void) {
+    clock_time_t time;
+
+    Send(UI_EVENT_SET_ALARM, 1);
+    Send(UI_EVENT_INCREMENT, 1);
+    Send(UI_EVENT_ACCEPT, 1);
+    Send(UI_EVENT_INCREMENT, 1);
+    Send(UI_EVENT_ACCEPT, 1);
+    TEST_ASSERT_EQUAL(MODE_UNSET, UiGetMode(ui));
+    TEST_ASSERT_TRUE(ClockGetAlarmTime(clock, &time));
+    AssertTime(&time, 0x01, 0x01);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,160 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_memoria_estatica.c
+ ** @brief Verifica que el reloj, la pantalla y las entradas y salidas digitales se crean sin memoria dinámica.
+ ** @details La prueba reemplaza malloc por una versión que siempre falla, por lo que cualquier objeto que dependa del
+ ** heap no se podría crear.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "clock.h"
+#include "screen.h"
+#include "digital.h"
+#include "chip.h"
+#include <stdlib.h>
+
+/* === Private macros definitions ================================================================================ */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void DigitsTurnOff(void);
+
+static void SegmentsUpdate(uint8_t segments);
+
+static void DigitTurnOn(uint8_t digit);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s driver = {
+    .DigitsTurnOff = DigitsTurnOff,
+    .SegmentsUpdate = SegmentsUpdate,
+    .DigitTurnOn = DigitTurnOn,
+};
+
+static uint32_t malloc_calls; // Cantidad de veces que se intentó pedir memoria dinámica
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void DigitsTurnOff(void) {
+}
+
+static void SegmentsUpdate(uint8_t segments) {
+    (void)segments;
+}
+
+static void DigitTurnOn(uint8_t digit) {
+    (void)digit;
+}
+
+/* === Public function definitions ================================================================================= */
+
+// Reemplaza al malloc de la biblioteca estándar, ninguna llamada puede obtener memoria
+void * malloc(size_t size) {
+    (void)size;
+    malloc_calls++;
+    return NULL;
+}
+
+void setUp(void) {
+    HostGpioReset();
+    malloc_calls = 0;
+}
+
+void tearDown(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, malloc_calls);
+}
+
+// La reserva entrega CLOCK_MAX_INSTANCES relojes y después informa que se agotó
+void test_clock_pool_runs_out(void) {
+    for (uint8_t i = 0; i < CLOCK_MAX_INSTANCES; i++) {
+        TEST_ASSERT_NOT_NULL(ClockCreate(1000));
+    }
+    TEST_ASSERT_NULL(ClockCreate(1000));
+}
+
+// La reserva entrega SCREEN_MAX_INSTANCES pantallas y después informa que se agotó
+void test_screen_pool_runs_out(void) {
+    for (uint8_t i = 0; i < SCREEN_MAX_INSTANCES; i++) {
+        TEST_ASSERT_NOT_NULL(ScreenCreate(4, 4, &driver));
+    }
+    TEST_ASSERT_NULL(ScreenCreate(4, 4, &driver));
+}
+
+// Las reservas de salidas y entradas se agotan por separado y los objetos entregados configuran sus terminales
+void test_digital_pools_run_out(void) {
+    for (uint8_t i = 0; i < DIGITAL_MAX_OUTPUTS; i++) {
+        TEST_ASSERT_NOT_NULL(DigitalOutputCreate(1, i, false));
+    }
+    TEST_ASSERT_NULL(DigitalOutputCreate(1, DIGITAL_MAX_OUTPUTS, false));
+
+    for (uint8_t i = 0; i < DIGITAL_MAX_INPUTS; i++) {
+        TEST_ASSERT_NOT_NULL(DigitalInputCreate(2, i, false));
+    }
+    TEST_ASSERT_NULL(DigitalInputCreate(2, DIGITAL_MAX_INPUTS, false));
+
+    TEST_ASSERT_EQUAL_HEX32((1UL << DIGITAL_MAX_OUTPUTS) - 1, host_gpio.DIR[1]);
+    TEST_ASSERT_EQUAL_HEX32(0, host_gpio.DIR[2]);
+}
+
+// Los objetos creados en memoria de la aplicación no dependen de las reservas y funcionan igual
+void test_create_in_application_storage(void) {
+    static clock_storage_t clock_storage;
+    static screen_storage_t screen_storage;
+    static digital_output_storage_t output_storage;
+    static digital_input_storage_t input_storage;
+    clock_time_t current_time;
+
+    clock_t clock = ClockCreateStatic(&clock_storage, 10);
+    TEST_ASSERT_NOT_NULL(clock);
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &(clock_time_t){0}));
+    TEST_ASSERT_FALSE(ClockAdvanceTicks(clock, 10));
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &current_time));
+    TEST_ASSERT_EQUAL_UINT8(1, current_time.time.seconds[0]);
+
+    TEST_ASSERT_NOT_NULL(ScreenCreateStatic(&screen_storage, 4, 4, &driver));
+
+    digital_output_t output = DigitalOutputCreateStatic(&output_storage, 3, 5, false);
+    TEST_ASSERT_NOT_NULL(output);
+    DigitalOutputToggle(output);
+    TEST_ASSERT_EQUAL_HEX32(1UL << 5, host_gpio.PIN[3]);
+
+    host_gpio.PIN[4] = 1UL << 7;
+    digital_input_t input = DigitalInputCreateStatic(&input_storage, 4, 7, false);
+    TEST_ASSERT_NOT_NULL(input);
+    TEST_ASSERT_TRUE(DigitalInputGetIsActive(input));
+}
+
+// Sin memoria o con parámetros inválidos no se crea ningún objeto
+void test_create_without_storage_fails(void) {
+    static clock_storage_t clock_storage;
+
+    TEST_ASSERT_NULL(ClockCreateStatic(NULL, 1000));
+    TEST_ASSERT_NULL(ClockCreateStatic(&clock_storage, 0));
+    TEST_ASSERT_NULL(ScreenCreateStatic(NULL, 4, 4, &driver));
+    TEST_ASSERT_NULL(DigitalOutputCreateStatic(NULL, 0, 0, false));
+    TEST_ASSERT_NULL(DigitalInputCreateStatic(NULL, 0, 0, false));
+}
+
+/* === End of conditional blocks =================================================================================== */
@@ -0,0 +1,325 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_pantalla.c
+ ** @brief Pruebas del doble buffer de la pantalla de 7 segmentos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "screen.h"
+#include <string.h>
+
+/* === Private macros definitions ================================================================================ */
+
+#define TEST_DIGITS 4
+
+#define IMAGE_1 (SEGMENT_B | SEGMENT_C)
+#define IMAGE_2 (SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G)
+#define IMAGE_3 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G)
+#define IMAGE_4 (SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G)
+#define IMAGE_8 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define IMAGE_A (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define IMAGE_E (SEGMENT_A | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define IMAGE_L (SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define IMAGE_n (SEGMENT_C | SEGMENT_E | SEGMENT_G)
+#define IMAGE_r (SEGMENT_E | SEGMENT_G)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void DigitsTurnOff(void);
+
+static void SegmentsUpdate(uint8_t segments);
+
+static void DigitTurnOn(uint8_t digit);
+
+static void DigitEncode(uint8_t digit, uint8_t segments, screen_digit_masks_t * masks);
+
+static void DigitWrite(const screen_digit_masks_t * masks);
+
+/**
+ * @brief Refresca la pantalla la cantidad de veces indicada.
+ */
+static void Refresh(uint8_t count);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s driver = {
+    .DigitsTurnOff = DigitsTurnOff,
+    .SegmentsUpdate = SegmentsUpdate,
+    .DigitTurnOn = DigitTurnOn,
+};
+
+// Controlador que precalcula las escrituras, guarda el dígito y los segmentos en las dos primeras palabras
+static const struct screen_driver_s bulk_driver = {
+    .DigitEncode = DigitEncode,
+    .DigitWrite = DigitWrite,
+};
+
+static screen_storage_t storage;
+static screen_t screen;
+static uint8_t segments_on;        // Segmentos que envió el último SegmentsUpdate
+static uint8_t shown[TEST_DIGITS]; // Segmentos con los que se encendió por última vez cada dígito
+static uint32_t encodes;           // Cantidad de dígitos que precalculó el controlador
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void DigitsTurnOff(void) {
+    segments_on = 0;
+}
+
+static void SegmentsUpdate(uint8_t segments) {
+    segments_on = segments;
+}
+
+static void DigitTurnOn(uint8_t digit) {
+    shown[digit] = segments_on;
+}
+
+static void DigitEncode(uint8_t digit, uint8_t segments, screen_digit_masks_t * masks) {
+    encodes++;
+    masks->words[0] = digit;
+    masks->words[1] = segments;
+}
+
+static void DigitWrite(const screen_digit_masks_t * masks) {
+    shown[masks->words[0]] = masks->words[1];
+}
+
+static void Refresh(uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        ScreenRefresh(screen);
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+void setUp(void) {
+    screen = ScreenCreateStatic(&storage, TEST_DIGITS, TEST_DIGITS, &driver);
+    memset(shown, 0xFF, sizeof(shown));
+    encodes = 0;
+}
+
+// Lo escrito se muestra desde el primer dígito del barrido siguiente, no a mitad del barrido actual
+void test_write_is_shown_from_next_frame(void) {
+    uint8_t value[TEST_DIGITS] = {1, 2, 3, 4};
+    const uint8_t expected[TEST_DIGITS] = {IMAGE_1, IMAGE_2, IMAGE_3, IMAGE_4};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    Refresh(TEST_DIGITS - 1);
+    TEST_ASSERT_EQUAL_UINT8(0, shown[1]);
+    TEST_ASSERT_EQUAL_UINT8(0, shown[3]);
+
+    Refresh(TEST_DIGITS);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, shown, TEST_DIGITS);
+}
+
+// Un cambio a mitad de barrido no mezcla dígitos nuevos y viejos en el mismo cuadro
+void test_write_during_frame_is_not_torn(void) {
+    uint8_t value[TEST_DIGITS] = {8, 8, 8, 8};
+
+    Refresh(TEST_DIGITS + 1);
+    ScreenWriteBCD(screen, value, sizeof(value));
+    Refresh(TEST_DIGITS - 2);
+    TEST_ASSERT_EQUAL_UINT8(0, shown[2]);
+    TEST_ASSERT_EQUAL_UINT8(0, shown[3]);
+
+    Refresh(TEST_DIGITS);
+    TEST_ASSERT_EACH_EQUAL_UINT8(IMAGE_8, shown, TEST_DIGITS);
+}
+
+// Escribir un dígito no modifica los demás ni su punto
+void test_write_digit_keeps_dot_and_other_digits(void) {
+    uint8_t value[TEST_DIGITS] = {1, 1, 1, 1};
+    uint8_t dots[TEST_DIGITS] = {0, 1, 0, 0};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    ScreenWriteDOT(screen, dots, sizeof(dots));
+    ScreenWriteDigit(screen, 1, 8);
+    Refresh(2 * TEST_DIGITS);
+
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_1, shown[0]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_8 | SEGMENT_P, shown[1]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_1, shown[2]);
+}
+
+// Repetir una escritura sin cambios antes del barrido no descarta los cambios pendientes
+void test_repeated_write_keeps_pending_changes(void) {
+    uint8_t value[TEST_DIGITS] = {2, 2, 2, 2};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    ScreenWriteBCD(screen, value, sizeof(value));
+    Refresh(2 * TEST_DIGITS);
+
+    TEST_ASSERT_EACH_EQUAL_UINT8(IMAGE_2, shown, TEST_DIGITS);
+}
+
+// Los cambios escritos después de un intercambio parten del cuadro que se está mostrando
+void test_write_after_swap_starts_from_shown_frame(void) {
+    uint8_t value[TEST_DIGITS] = {3, 3, 3, 3};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    Refresh(TEST_DIGITS);
+    ScreenToggleDot(screen, 0);
+    Refresh(TEST_DIGITS);
+
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_3 | SEGMENT_P, shown[0]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_3, shown[1]);
+}
+
+// Los valores que no son un dígito decimal apagan el dígito
+void test_invalid_digit_is_blank(void) {
+    uint8_t value[TEST_DIGITS] = {8, 8, 8, 8};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    ScreenWriteDigit(screen, 3, 10);
+    Refresh(2 * TEST_DIGITS);
+
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_8, shown[2]);
+    TEST_ASSERT_EQUAL_UINT8(0, shown[3]);
+}
+
+// Con un controlador que precalcula las escrituras solo se codifican los dígitos que cambian
+void test_bulk_driver_encodes_only_changed_digits(void) {
+    uint8_t value[TEST_DIGITS] = {1, 2, 3, 4};
+
+    screen = ScreenCreateStatic(&storage, TEST_DIGITS, TEST_DIGITS, &bulk_driver);
+    encodes = 0;
+
+    // Cada dígito se codifica con y sin el punto, para poder hacer parpadear el punto sin codificar en el refresco
+    ScreenWriteBCD(screen, value, sizeof(value));
+    TEST_ASSERT_EQUAL_UINT32(2 * TEST_DIGITS, encodes);
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    Refresh(TEST_DIGITS);
+    ScreenWriteBCD(screen, value, sizeof(value));
+    TEST_ASSERT_EQUAL_UINT32(2 * TEST_DIGITS, encodes);
+
+    ScreenWriteDigit(screen, 2, 8);
+    TEST_ASSERT_EQUAL_UINT32(2 * TEST_DIGITS + 2, encodes);
+}
+
+// El refresco con el controlador que precalcula las escrituras muestra el cuadro y respeta el parpadeo
+void test_bulk_driver_refresh_uses_precomputed_masks(void) {
+    uint8_t value[TEST_DIGITS] = {1, 2, 3, 4};
+    const uint8_t expected[TEST_DIGITS] = {IMAGE_1, IMAGE_2, IMAGE_3, IMAGE_4};
+
+    screen = ScreenCreateStatic(&storage, TEST_DIGITS, TEST_DIGITS, &bulk_driver);
+    ScreenWriteBCD(screen, value, sizeof(value));
+    Refresh(2 * TEST_DIGITS);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, shown, TEST_DIGITS);
+
+    DisplayFlashDigits(screen, 1, 2, 1);
+    Refresh(2 * TEST_DIGITS);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_1, shown[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, shown[1]);
+    TEST_ASSERT_EQUAL_UINT8(0, shown[2]);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_4, shown[3]);
+}
+
+// Dos grupos de parpadeo funcionan a distinta velocidad, uno sobre un dígito y otro sobre un punto
+void test_blink_groups_at_different_rates(void) {
+    uint8_t value[TEST_DIGITS] = {8, 8, 8, 8};
+    uint8_t dots[TEST_DIGITS] = {0, 1, 0, 0};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    ScreenWriteDOT(screen, dots, sizeof(dots));
+    TEST_ASSERT_EQUAL_INT(0, ScreenSetBlink(screen, 0, 1 << 3, 0, 0));
+    TEST_ASSERT_EQUAL_INT(0, ScreenSetBlink(screen, 1, 0, 1 << 1, 1));
+    Refresh(TEST_DIGITS);
+
+    // Los dígitos 1 a 3 de cada barrido se muestran con el contador de barridos en frame
+    for (uint8_t frame = 1; frame <= 8; frame++) {
+        Refresh(TEST_DIGITS);
+        TEST_ASSERT_EQUAL_UINT8((frame & 1) ? 0 : IMAGE_8, shown[3]);
+        TEST_ASSERT_EQUAL_UINT8((frame & 2) ? IMAGE_8 : IMAGE_8 | SEGMENT_P, shown[1]);
+        TEST_ASSERT_EQUAL_UINT8(IMAGE_8, shown[2]);
+    }
+}
+
+// Los grupos de parpadeo rechazan parámetros fuera de rango
+void test_blink_rejects_invalid_group_and_shift(void) {
+    TEST_ASSERT_EQUAL_INT(-1, ScreenSetBlink(screen, SCREEN_BLINK_GROUPS, 1, 0, 0));
+    TEST_ASSERT_EQUAL_INT(-1, ScreenSetBlink(screen, 0, 1, 0, SCREEN_BLINK_MAX_SHIFT + 1));
+    TEST_ASSERT_EQUAL_INT(-1, DisplayFlashDigits(screen, 2, 1, 10));
+}
+
+// Los textos se muestran con un carácter por dígito, apagando los que sobran y conservando los puntos
+void test_write_text_shows_status_words(void) {
+    uint8_t dots[TEST_DIGITS] = {0, 1, 0, 0};
+    const uint8_t expected[TEST_DIGITS] = {IMAGE_A, IMAGE_L | SEGMENT_P, 0, 0};
+
+    ScreenWriteDOT(screen, dots, sizeof(dots));
+    ScreenWriteText(screen, "AL");
+    Refresh(2 * TEST_DIGITS);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, shown, TEST_DIGITS);
+
+    ScreenWriteText(screen, "SnZ");
+    Refresh(2 * TEST_DIGITS);
+    TEST_ASSERT_EQUAL_UINT8(IMAGE_n | SEGMENT_P, shown[1]);
+}
+
+// Los caracteres fuera de ASCII se apagan y el texto que no entra en la pantalla se descarta
+void test_write_text_ignores_unknown_and_extra_characters(void) {
+    const uint8_t expected[TEST_DIGITS] = {IMAGE_E, IMAGE_r, IMAGE_r, 0};
+
+    ScreenWriteText(screen, "Err\x80" "8");
+    Refresh(2 * TEST_DIGITS);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, shown, TEST_DIGITS);
+}
+
+// La marquesina hace pasar el texto de derecha a izquierda y vuelve a empezar con la pantalla apagada
+void test_marquee_scrolls_and_restarts(void) {
+    const uint8_t expected[][TEST_DIGITS] = {
+        {0, 0, 0, IMAGE_A}, {0, 0, IMAGE_A, IMAGE_L}, {0, IMAGE_A, IMAGE_L, 0},
+        {IMAGE_A, IMAGE_L, 0, 0}, {IMAGE_L, 0, 0, 0},
+    };
+
+    TEST_ASSERT_EQUAL_INT(0, ScreenMarqueeStart(screen, "AL"));
+    Refresh(2 * TEST_DIGITS);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, shown, TEST_DIGITS);
+
+    for (uint8_t step = 0; step < sizeof(expected) / sizeof(expected[0]); step++) {
+        TEST_ASSERT_FALSE(ScreenMarqueeStep(screen));
+        Refresh(2 * TEST_DIGITS);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected[step], shown, TEST_DIGITS);
+    }
+    TEST_ASSERT_TRUE(ScreenMarqueeStep(screen));
+    Refresh(2 * TEST_DIGITS);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, shown, TEST_DIGITS);
+}
+
+// La marquesina rechaza los textos que no entran en el anillo
+void test_marquee_rejects_text_longer_than_ring(void) {
+    char text[SCREEN_MARQUEE_LENGTH];
+
+    memset(text, 'A', sizeof(text));
+    text[SCREEN_MARQUEE_LENGTH - 2 * TEST_DIGITS + 1] = '\0';
+    TEST_ASSERT_EQUAL_INT(-1, ScreenMarqueeStart(screen, text));
+    TEST_ASSERT_FALSE(ScreenMarqueeStep(screen));
+
+    text[SCREEN_MARQUEE_LENGTH - 2 * TEST_DIGITS] = '\0';
+    TEST_ASSERT_EQUAL_INT(0, ScreenMarqueeStart(screen, text));
+}
+
+/* === End of conditional blocks =================================================================================== */
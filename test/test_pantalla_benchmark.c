@@ -0,0 +1,213 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_pantalla_benchmark.c
+ ** @brief Mide en el host los ciclos por dígito del refresco con el controlador en línea y con punteros a funciones.
+ ** @details Se compila con SCREEN_INLINE_DRIVER, por lo que el modulo de pantalla llama directamente al controlador de
+ ** screen_driver.h. Para comparar se usa una copia del camino de refresco que llama al mismo controlador a través de
+ ** screen_driver_t, como lo hace la placa sin esa opción.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _POSIX_C_SOURCE 199309L // Necesario para clock_gettime con -std=c99
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "unity.h"
+#include "chip.h"
+#include "screen.h"
+#include "screen_driver.h"
+
+/* === Private macros definitions ================================================================================ */
+
+#define BENCHMARK_DIGITS    4        // Dígitos de la pantalla del poncho
+#define BENCHMARK_REFRESHES 20000000 // Dígitos refrescados en cada medición
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Estado que usa el refresco copiado, el mismo que consulta ScreenRefresh en cada dígito.
+ */
+typedef struct {
+    screen_driver_t driver;
+    screen_digit_masks_t masks[2][BENCHMARK_DIGITS];
+    screen_digit_masks_t nodot[2][BENCHMARK_DIGITS];
+    screen_digit_masks_t blank[BENCHMARK_DIGITS];
+    uint32_t blink[SCREEN_BLINK_GROUPS];
+    uint16_t phase;
+    uint8_t digits;
+    uint8_t currentDigit;
+    uint8_t off_digits;
+    uint8_t off_dots;
+    uint8_t state;
+} pointer_screen_t;
+
+/* === Private function declarations =============================================================================== */
+
+static void DigitEncode(uint8_t digit, uint8_t segments, screen_digit_masks_t * masks);
+
+static void DigitWrite(const screen_digit_masks_t * masks);
+
+/**
+ * @brief Copia de ScreenRefresh con el controlador llamado a través de punteros a funciones.
+ */
+static void PointerRefresh(pointer_screen_t * screen);
+
+/**
+ * @brief Devuelve un contador de ciclos del procesador del host, o nanosegundos si no tiene uno accesible.
+ */
+static uint64_t ReadCycles(void);
+
+/**
+ * @brief Escribe en el texto los ciclos por dígito de una medición, con dos decimales.
+ */
+static const char * Cycles(uint64_t cycles, char * text);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s driver = {
+    .DigitEncode = DigitEncode,
+    .DigitWrite = DigitWrite,
+};
+
+static screen_storage_t storage;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+// Como en bsp.c, donde el controlador está en otra unidad de compilación y no se puede expandir en el refresco
+__attribute__((noinline)) static void DigitEncode(uint8_t digit, uint8_t segments, screen_digit_masks_t * masks) {
+    ScreenDriverDigitEncode(digit, segments, masks);
+}
+
+__attribute__((noinline)) static void DigitWrite(const screen_digit_masks_t * masks) {
+    ScreenDriverDigitWrite(masks);
+}
+
+static void PointerRefresh(pointer_screen_t * screen) {
+    uint8_t front;
+    uint8_t digit;
+    uint8_t bit;
+
+    screen->currentDigit = (screen->currentDigit + 1) % screen->digits;
+    digit = screen->currentDigit;
+    bit = 1 << digit;
+
+    if (digit == 0) {
+        uint8_t off_digits = 0;
+        uint8_t off_dots = 0;
+
+        (void)__atomic_load_n(&screen->state, __ATOMIC_ACQUIRE);
+        screen->phase++;
+        for (uint8_t group = 0; group < SCREEN_BLINK_GROUPS; group++) {
+            uint32_t blink = __atomic_load_n(&screen->blink[group], __ATOMIC_RELAXED);
+            if ((screen->phase >> (uint8_t)(blink >> 16)) & 1) {
+                off_digits |= (uint8_t)blink;
+                off_dots |= (uint8_t)(blink >> 8);
+            }
+        }
+        screen->off_digits = off_digits;
+        screen->off_dots = off_dots;
+    }
+    front = __atomic_load_n(&screen->state, __ATOMIC_ACQUIRE) & 1;
+
+    if (screen->driver->DigitWrite) {
+        if (screen->off_digits & bit) {
+            screen->driver->DigitWrite(&screen->blank[digit]);
+        } else if (screen->off_dots & bit) {
+            screen->driver->DigitWrite(&screen->nodot[front][digit]);
+        } else {
+            screen->driver->DigitWrite(&screen->masks[front][digit]);
+        }
+    }
+}
+
+static uint64_t ReadCycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+#endif
+}
+
+static const char * Cycles(uint64_t cycles, char * text) {
+    uint64_t hundredths = cycles * 100 / BENCHMARK_REFRESHES;
+
+    sprintf(text, "%llu.%02llu", (unsigned long long)(hundredths / 100), (unsigned long long)(hundredths % 100));
+    return text;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void setUp(void) {
+    HostGpioReset();
+}
+
+// Los dos caminos dejan las mismas escrituras en los puertos y se informan los ciclos por dígito de cada uno
+void test_benchmark_cycles_per_digit(void) {
+    static const uint8_t segments[BENCHMARK_DIGITS] = {
+        SEGMENT_B | SEGMENT_C,                                     // 1
+        SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G, // 2
+        SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G, // 3
+        SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,             // 4
+    };
+    static pointer_screen_t copy = {.driver = &driver, .digits = BENCHMARK_DIGITS};
+    uint8_t value[BENCHMARK_DIGITS] = {1, 2, 3, 4};
+    LPC_GPIO_T expected;
+    char message[128];
+    char text[32];
+
+    for (uint8_t i = 0; i < BENCHMARK_DIGITS; i++) {
+        DigitEncode(i, segments[i], &copy.masks[0][i]);
+    }
+    screen_t screen = ScreenCreateStatic(&storage, BENCHMARK_DIGITS, BENCHMARK_DIGITS, NULL);
+    ScreenWriteBCD(screen, value, sizeof(value));
+    for (uint8_t i = 0; i < 2 * BENCHMARK_DIGITS; i++) {
+        ScreenRefresh(screen);
+    }
+
+    uint64_t start = ReadCycles();
+    for (uint32_t i = 0; i < BENCHMARK_REFRESHES; i++) {
+        PointerRefresh(&copy);
+    }
+    uint64_t pointer_cycles = ReadCycles() - start;
+    memcpy(&expected, &host_gpio, sizeof(expected));
+
+    start = ReadCycles();
+    for (uint32_t i = 0; i < BENCHMARK_REFRESHES; i++) {
+        ScreenRefresh(screen);
+    }
+    uint64_t inline_cycles = ReadCycles() - start;
+
+    TEST_ASSERT_EQUAL_HEX32(expected.SET[SEGMENTS_GPIO], host_gpio.SET[SEGMENTS_GPIO]);
+    TEST_ASSERT_EQUAL_HEX32(expected.CLR[SEGMENTS_GPIO], host_gpio.CLR[SEGMENTS_GPIO]);
+    TEST_ASSERT_EQUAL_HEX32(expected.SET[DIGITS_GPIO], host_gpio.SET[DIGITS_GPIO]);
+    TEST_ASSERT_EQUAL_UINT8(expected.B[SEGMENT_P_GPIO][SEGMENT_P_BIT], host_gpio.B[SEGMENT_P_GPIO][SEGMENT_P_BIT]);
+
+    snprintf(message, sizeof(message), "Punteros a funciones: %s ciclos por dígito", Cycles(pointer_cycles, text));
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message), "Controlador en línea: %s ciclos por dígito", Cycles(inline_cycles, text));
+    TEST_MESSAGE(message);
+}
+
+/* === End of conditional blocks =================================================================================== */
@@ -0,0 +1,123 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_pantalla_serie.c
+ ** @brief Pruebas de las pantallas encadenadas por una interfaz serie y del costo de cada actualización.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "screen.h"
+#include "serial_screen.h"
+#include "host_serial.h"
+#include <stdio.h>
+#include <string.h>
+
+/* === Private macros definitions ================================================================================ */
+
+#define IMAGE_1 (SEGMENT_B | SEGMENT_C)
+#define IMAGE_8 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static host_serial_t serial;
+static const struct serial_transport_s transport = {.Send = HostSerialSend, .object = &serial};
+static serial_screen_storage_t storage;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+void setUp(void) {
+    HostSerialReset(&serial);
+}
+
+// Una cadena de registros de desplazamiento se envía completa cuando cambia un dígito y no se envía sin cambios
+void test_shift_register_sends_whole_chain_only_on_change(void) {
+    serial_screen_t screen = SerialScreenCreateStatic(&storage, SERIAL_SCREEN_SHIFT_REGISTER, 4, &transport);
+    const uint8_t expected[] = {IMAGE_1, IMAGE_8, 0, 0};
+
+    TEST_ASSERT_EQUAL_UINT32(0, serial.calls);
+    SerialScreenWriteText(screen, "18");
+    TEST_ASSERT_EQUAL_UINT16(4, SerialScreenUpdate(screen));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, serial.data, sizeof(expected));
+    TEST_ASSERT_EQUAL_UINT32(1, serial.latches);
+
+    SerialScreenWriteText(screen, "18");
+    TEST_ASSERT_EQUAL_UINT16(0, SerialScreenUpdate(screen));
+    TEST_ASSERT_EQUAL_UINT32(1, serial.calls);
+
+    SerialScreenWriteSegments(screen, 3, (const uint8_t[]){SEGMENT_P}, 1);
+    TEST_ASSERT_EQUAL_UINT16(4, SerialScreenUpdate(screen));
+    TEST_ASSERT_EQUAL_UINT32(2 * 4 * 8, serial.bits);
+}
+
+// Una cadena tipo MAX7219 se configura al crearla y luego envía solo las posiciones que cambiaron
+void test_max7219_sends_only_changed_digits(void) {
+    serial_screen_t screen = SerialScreenCreateStatic(&storage, SERIAL_SCREEN_MAX7219, 16, &transport);
+    const uint8_t frame[] = {0x00, 0x00, 0x03, 0x30};
+
+    TEST_ASSERT_EQUAL_UINT32(5, serial.latches);
+    HostSerialReset(&serial);
+
+    TEST_ASSERT_EQUAL_UINT16(8 * 4, SerialScreenUpdate(screen));
+    TEST_ASSERT_EQUAL_UINT32(8, serial.latches);
+    TEST_ASSERT_EQUAL_UINT32(1, serial.calls);
+
+    // El dígito 10 es la tercera posición del segundo controlador, el primero recibe una operación nula
+    SerialScreenWriteSegments(screen, 10, (const uint8_t[]){IMAGE_1}, 1);
+    TEST_ASSERT_EQUAL_UINT16(sizeof(frame), SerialScreenUpdate(screen));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(frame, serial.data, sizeof(frame));
+    TEST_ASSERT_EQUAL_UINT16(0, SerialScreenUpdate(screen));
+}
+
+// Bits desplazados al cambiar un dígito en cadenas de 4 a 64 dígitos
+void test_update_cost_by_chain_length(void) {
+    static const uint8_t lengths[] = {4, 8, 16, 32, 64};
+    char message[128];
+
+    for (uint8_t i = 0; i < sizeof(lengths); i++) {
+        uint32_t bits[2];
+
+        for (uint8_t type = 0; type < 2; type++) {
+            serial_screen_t screen = SerialScreenCreateStatic(&storage, type, lengths[i], &transport);
+
+            SerialScreenUpdate(screen);
+            HostSerialReset(&serial);
+            SerialScreenWriteSegments(screen, lengths[i] - 1, (const uint8_t[]){IMAGE_8}, 1);
+            TEST_ASSERT_NOT_EQUAL(0, SerialScreenUpdate(screen));
+            bits[type] = serial.bits;
+        }
+        TEST_ASSERT_EQUAL_UINT32(8UL * lengths[i], bits[SERIAL_SCREEN_SHIFT_REGISTER]);
+        TEST_ASSERT_EQUAL_UINT32(16UL * SERIAL_SCREEN_DEVICES(lengths[i]), bits[SERIAL_SCREEN_MAX7219]);
+
+        snprintf(message, sizeof(message), "%2u dígitos: registros de desplazamiento %4lu bits, MAX7219 %3lu bits",
+                 lengths[i], (unsigned long)bits[SERIAL_SCREEN_SHIFT_REGISTER],
+                 (unsigned long)bits[SERIAL_SCREEN_MAX7219]);
+        TEST_MESSAGE(message);
+    }
+}
+
+/* === End of conditional blocks =================================================================================== */
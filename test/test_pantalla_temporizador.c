@@ -0,0 +1,107 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_pantalla_temporizador.c
+ ** @brief Verifica el multiplexado de la pantalla desde el temporizador simulado de la placa POSIX.
+ ** @details El temporizador del sistema de la placa POSIX llama a ScreenRefreshEvent desde otro hilo, mientras la
+ ** prueba escribe la pantalla como lo haría una tarea.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "screen.h"
+#include "soc_tick.h"
+#include "host_tasks.h"
+
+/* === Private macros definitions ================================================================================ */
+
+#define TEST_DIGITS    4
+#define SLOT_TIME_US   200 // Tiempo que queda encendido cada dígito
+#define WRITES         500 // Cantidad de escrituras mientras se multiplexa la pantalla
+#define WRITE_DELAY_US 100 // Tiempo entre escrituras
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void DigitsTurnOff(void);
+
+static void SegmentsUpdate(uint8_t segments);
+
+static void DigitTurnOn(uint8_t digit);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s driver = {
+    .DigitsTurnOff = DigitsTurnOff,
+    .SegmentsUpdate = SegmentsUpdate,
+    .DigitTurnOn = DigitTurnOn,
+};
+
+// Las modifica el hilo del temporizador, la prueba las lee al terminar
+static uint8_t segments_on;    // Segmentos que envió el último SegmentsUpdate
+static uint8_t frame_segments; // Segmentos del primer dígito del barrido actual
+static uint32_t frames;        // Barridos completos
+static uint32_t torn_frames;   // Barridos que mezclaron dígitos de dos escrituras distintas
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void DigitsTurnOff(void) {
+    segments_on = 0;
+}
+
+static void SegmentsUpdate(uint8_t segments) {
+    segments_on = segments;
+}
+
+static void DigitTurnOn(uint8_t digit) {
+    if (digit == 0) {
+        frame_segments = segments_on;
+    } else if (segments_on != frame_segments) {
+        __atomic_add_fetch(&torn_frames, 1, __ATOMIC_RELAXED);
+    }
+    if (digit == TEST_DIGITS - 1) {
+        __atomic_add_fetch(&frames, 1, __ATOMIC_RELAXED);
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+// El temporizador multiplexa la pantalla sin ninguna tarea y nunca muestra un cuadro a medio escribir
+void test_timer_refreshes_whole_frames(void) {
+    static screen_storage_t storage;
+    uint8_t ones[TEST_DIGITS] = {1, 1, 1, 1};
+    uint8_t eights[TEST_DIGITS] = {8, 8, 8, 8};
+
+    screen_t screen = ScreenCreateStatic(&storage, TEST_DIGITS, TEST_DIGITS, &driver);
+    TickStart(ScreenRefreshEvent, screen, SLOT_TIME_US);
+
+    for (uint32_t i = 0; i < WRITES; i++) {
+        ScreenWriteBCD(screen, (i & 1) ? ones : eights, TEST_DIGITS);
+        HostSleep(WRITE_DELAY_US);
+    }
+
+    // Se escribieron al menos WRITES / 2 cuadros distintos, con un barrido cada TEST_DIGITS * SLOT_TIME_US
+    TEST_ASSERT_GREATER_THAN_UINT32(10, __atomic_load_n(&frames, __ATOMIC_RELAXED));
+    TEST_ASSERT_EQUAL_UINT32(0, __atomic_load_n(&torn_frames, __ATOMIC_RELAXED));
+}
+
+/* === End of conditional blocks =================================================================================== */
@@ -0,0 +1,156 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_pantalla_virtual.c
+ ** @brief Pruebas de la pantalla virtual que registra el refresco de la pantalla de 7 segmentos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "screen.h"
+#include "virtual_screen.h"
+
+/* === Private macros definitions ================================================================================ */
+
+#define TEST_DIGITS 4
+#define TEST_SLOT   1000 // Microsegundos entre dos refrescos
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Reloj simulado de la pantalla virtual.
+ */
+static uint32_t Clock(void);
+
+/**
+ * @brief Refresca la pantalla la cantidad de veces indicada, avanzando el reloj un intervalo entre refrescos.
+ */
+static void Refresh(uint16_t count);
+
+/* === Private variable definitions ================================================================================ */
+
+static screen_storage_t storage;
+static screen_t screen;
+static screen_driver_t driver;
+static uint32_t now;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Clock(void) {
+    return now;
+}
+
+static void Refresh(uint16_t count) {
+    for (uint16_t i = 0; i < count; i++) {
+        ScreenRefresh(screen);
+        now += TEST_SLOT;
+    }
+}
+
+/* === Public function definitions ================================================================================= */
+
+void setUp(void) {
+    uint8_t value[TEST_DIGITS] = {1, 2, 3, 4};
+
+    now = 0;
+    driver = VirtualScreenCreate(TEST_DIGITS, Clock, 50);
+    screen = ScreenCreateStatic(&storage, TEST_DIGITS, TEST_DIGITS, driver);
+    ScreenWriteBCD(screen, value, sizeof(value));
+}
+
+// Con un refresco regular se miden la frecuencia de barrido y el tiempo encendido de cada dígito, sin fantasmas
+void test_regular_refresh_stats(void) {
+    virtual_screen_stats_t stats;
+
+    // Cada registro se completa al apagarse el dígito, en el refresco siguiente
+    Refresh(10 * TEST_DIGITS + 1);
+    VirtualScreenGetStats(&stats);
+
+    TEST_ASSERT_EQUAL_UINT32(10, stats.scans);
+    TEST_ASSERT_EQUAL_UINT32(TEST_DIGITS * TEST_SLOT, stats.scan_period);
+    TEST_ASSERT_EQUAL_UINT32(250, stats.refresh_rate);
+    TEST_ASSERT_EACH_EQUAL_UINT32(TEST_SLOT, stats.on_time, TEST_DIGITS);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.jitter);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.ghosts);
+}
+
+// Un refresco atrasado aparece como variación entre encendidos
+void test_late_refresh_is_jitter(void) {
+    virtual_screen_stats_t stats;
+
+    Refresh(TEST_DIGITS);
+    now += 500;
+    Refresh(TEST_DIGITS);
+    VirtualScreenGetStats(&stats);
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_SLOT, stats.slot_min);
+    TEST_ASSERT_EQUAL_UINT32(TEST_SLOT + 500, stats.slot_max);
+    TEST_ASSERT_EQUAL_UINT32(500, stats.jitter);
+}
+
+// Cambiar los segmentos con un dígito encendido o encender dos dígitos a la vez se cuenta como fantasma
+void test_ghosting_is_detected(void) {
+    virtual_screen_stats_t stats;
+
+    driver->DigitsTurnOff();
+    driver->SegmentsUpdate(SEGMENT_A);
+    driver->DigitTurnOn(0);
+    driver->SegmentsUpdate(SEGMENT_B);
+    driver->DigitTurnOn(1);
+    VirtualScreenGetStats(&stats);
+
+    TEST_ASSERT_EQUAL_UINT32(2, stats.ghosts);
+}
+
+// El anillo guarda los encendidos más recientes, en orden
+void test_records_keep_latest(void) {
+    virtual_screen_record_t records[3];
+
+    Refresh(VIRTUAL_SCREEN_RECORDS + 10);
+
+    TEST_ASSERT_EQUAL_UINT16(3, VirtualScreenRecords(records, 3));
+    TEST_ASSERT_EQUAL_UINT32(records[0].start + TEST_SLOT, records[1].start);
+    TEST_ASSERT_EQUAL_UINT32(records[1].start + TEST_SLOT, records[2].start);
+    TEST_ASSERT_EQUAL_UINT32((VIRTUAL_SCREEN_RECORDS + 8) * TEST_SLOT, records[2].start);
+}
+
+// La pantalla se dibuja como texto, como mucho la cantidad de veces por segundo indicada
+void test_render_ascii_with_rate_cap(void) {
+    static const char expected[] = "     _   _      \n"
+                                   "  |  _|  _| |_| \n"
+                                   "  | |_ . _|   | \n";
+    uint8_t dots[TEST_DIGITS] = {0, 1, 0, 0};
+    char text[VIRTUAL_SCREEN_RENDER_SIZE(TEST_DIGITS)];
+
+    ScreenWriteDOT(screen, dots, sizeof(dots));
+    Refresh(2 * TEST_DIGITS);
+    TEST_ASSERT_TRUE(VirtualScreenRender(text, sizeof(text)));
+    TEST_ASSERT_EQUAL_STRING(expected, text);
+
+    now += 10000;
+    TEST_ASSERT_FALSE(VirtualScreenRender(text, sizeof(text)));
+    now += 10000;
+    TEST_ASSERT_TRUE(VirtualScreenRender(text, sizeof(text)));
+}
+
+/* === End of conditional blocks =================================================================================== */
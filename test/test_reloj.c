@@ -42,6 +42,17 @@ SPDX-License-Identifier: MIT
 
 /* === Private data type declarations ============================================================================== */
 
+/**
+ * @brief Registro de los eventos recibidos por la función de eventos del reloj.
+ */
+typedef struct {
+    uint32_t calls;                // Cantidad de veces que se llamó a la función
+    uint32_t seconds;              // Cantidad de eventos de segundo recibidos
+    uint32_t minutes;              // Cantidad de eventos de minuto recibidos
+    uint32_t alarms;               // Cantidad de eventos de alarma recibidos
+    clock_time_t last_minute_time; // Hora leida desde la función en el ultimo evento de minuto
+} event_log_t;
+
 /* === Private function declarations =============================================================================== */
 /**
  * @brief Simula el avance del reloj en segundos.
@@ -52,6 +63,11 @@ SPDX-License-Identifier: MIT
  * llamando a ClockNewTick para cada tick del reloj.
  */
 static void SimulateSeconds(clock_t clock, uint32_t seconds);
+
+/**
+ * @brief Función de eventos del reloj que registra los eventos recibidos en un event_log_t.
+ */
+static void LogEvents(clock_t clock, uint8_t events, void * object);
 /* === Private variable definitions ================================================================================ */
 
 /* === Public variable definitions ================================================================================= */
@@ -63,6 +79,18 @@ static void SimulateSeconds(clock_t clock, uint32_t seconds) {
         ClockNewTick(clock); // Simula un tic del reloj
     }
 }
+
+static void LogEvents(clock_t clock, uint8_t events, void * object) {
+    event_log_t * log = object;
+
+    log->calls++;
+    log->seconds += (events & CLOCK_EVENT_SECOND) ? 1 : 0;
+    log->minutes += (events & CLOCK_EVENT_MINUTE) ? 1 : 0;
+    log->alarms += (events & CLOCK_EVENT_ALARM) ? 1 : 0;
+    if (events & CLOCK_EVENT_MINUTE) {
+        ClockGetTime(clock, &log->last_minute_time); // La función puede consultar el reloj
+    }
+}
 /* === Header for C++ compatibility ================================================================================
  */
 
@@ -84,10 +112,11 @@ static void SimulateSeconds(clock_t clock, uint32_t seconds) {
 /* === Private function implementation ========================================================= */
 
 /* === Public function implementation ========================================================= */
-clock_t clock; // Variable global para el reloj
+clock_t clock;                // Variable global para el reloj
+clock_storage_t clock_storage; // Memoria del reloj, cada prueba lo vuelve a crear en el mismo lugar
 void setUp(void) {
     // Esta función se ejecuta antes de cada prueba
-    clock = ClockCreate(CLOCK_TICKS_PER_SECOND); // Crea el reloj con la frecuencia especificada
+    clock = ClockCreateStatic(&clock_storage, CLOCK_TICKS_PER_SECOND); // Crea el reloj con la frecuencia especificada
 }
 
 //  Al inicializar el reloj está en 00:00 y con hora invalida.
@@ -96,7 +125,8 @@ void test_set_up_with_invalid_time(void) {
         .bcd = {1, 2, 3, 4, 5, 6},
     };
 
-    clock_t clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    clock_storage_t storage;
+    clock_t clock = ClockCreateStatic(&storage, CLOCK_TICKS_PER_SECOND);
     TEST_ASSERT_FALSE(ClockGetTime(clock, &current_time));
     TEST_ASSERT_EACH_EQUAL_UINT8(0, current_time.bcd, 6);
 }
@@ -364,7 +394,8 @@ void test_set_invalid_time_values(void) {
 // Hacer una prueba con una frecuencia de reloj diferente.
 void test_clock_with_different_frequency(void) {
     const uint8_t new_ticks_per_second = 10;
-    clock_t fast_clock = ClockCreate(new_ticks_per_second);
+    clock_storage_t storage;
+    clock_t fast_clock = ClockCreateStatic(&storage, new_ticks_per_second);
 
     // Seteo la hora a 00:00:00
     clock_time_t initial_time = {.time = {{0, 0}, {0, 0}, {0, 0}}};
@@ -387,4 +418,454 @@ void test_clock_with_different_frequency(void) {
     TEST_ASSERT_EQUAL_UINT8(0, result.time.hours[1]);
 }
 
+// Avanzar el reloj en bloque deja la misma hora que avanzarlo tick a tick.
+void test_advance_ticks_matches_single_ticks(void) {
+    static const clock_time_t start_time = {.time = {.seconds = {7, 5}, .minutes = {9, 5}, .hours = {3, 2}}};
+    clock_storage_t storage;
+    clock_t reference = ClockCreateStatic(&storage, CLOCK_TICKS_PER_SECOND);
+    clock_time_t expected;
+    clock_time_t result;
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &start_time));
+    TEST_ASSERT_TRUE(ClockSetTime(reference, &start_time));
+
+    // 3 ticks sueltos y luego un bloque que cruza la medianoche sin quedar alineado al segundo
+    for (int i = 0; i < 3; i++) {
+        ClockNewTick(clock);
+    }
+    ClockAdvanceTicks(clock, 4 * CLOCK_TICKS_PER_SECOND + 4);
+    SimulateSeconds(reference, 5);
+    ClockNewTick(reference);
+    ClockNewTick(reference);
+
+    TEST_ASSERT_TRUE(ClockGetTime(reference, &expected));
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &result));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected.bcd, result.bcd, sizeof(clock_time_t));
+}
+
+// Avanzar el reloj en bloque por encima de la hora de la alarma la hace sonar y lo informa.
+void test_advance_ticks_reports_skipped_alarm(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {1, 0}, .hours = {0, 0}}};
+
+    static const clock_time_t start_time = {.time = {.seconds = {0, 0}, .minutes = {9, 5}, .hours = {3, 2}}};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &start_time));
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &alarm_time));
+    ClockEnableAlarm(clock);
+
+    // 23:59:00 + 1 minuto y 59 segundos = 00:00:59, todavia no llega a la alarma
+    TEST_ASSERT_FALSE(ClockAdvanceTicks(clock, 119 * CLOCK_TICKS_PER_SECOND));
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+
+    // Saltar 10 minutos de una vez pasa por encima de las 00:01:00
+    TEST_ASSERT_TRUE(ClockAdvanceTicks(clock, 600 * CLOCK_TICKS_PER_SECOND));
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_TIME(0, 0, 1, 0, 5, 9, current_time);
+}
+
+// Avanzar el reloj en bloque por encima de la alarma pospuesta la hace sonar.
+void test_advance_ticks_reports_skipped_snooze(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {7, 0}}};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &alarm_time));
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &alarm_time));
+    ClockEnableAlarm(clock);
+    TEST_ASSERT_TRUE(ClockSnoozeAlarm(clock, 5));
+
+    TEST_ASSERT_FALSE(ClockAdvanceTicks(clock, 299 * CLOCK_TICKS_PER_SECOND));
+    TEST_ASSERT_TRUE(ClockAdvanceTicks(clock, 2 * CLOCK_TICKS_PER_SECOND));
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+}
+
+// Avanzar mas de un dia completo siempre pasa por la hora de la alarma.
+void test_advance_ticks_more_than_one_day(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {2, 1}}};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &alarm_time));
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &alarm_time));
+    ClockEnableAlarm(clock);
+
+    TEST_ASSERT_TRUE(ClockAdvanceTicks(clock, 3 * 86400 * CLOCK_TICKS_PER_SECOND + CLOCK_TICKS_PER_SECOND));
+    TEST_ASSERT_TIME(1, 2, 0, 0, 0, 1, current_time);
+}
+
+// Los ticks hasta el proximo evento respetan el segundo, el minuto y la alarma pedidos.
+void test_ticks_until_next_event(void) {
+    static const clock_time_t start_time = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {7, 0}}};
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 3}, .minutes = {0, 0}, .hours = {7, 0}}};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &start_time));
+    ClockNewTick(clock);
+
+    TEST_ASSERT_EQUAL_UINT32(CLOCK_TICKS_PER_SECOND - 1, ClockTicksUntilNextEvent(clock, CLOCK_EVENT_SECOND));
+    TEST_ASSERT_EQUAL_UINT32(60 * CLOCK_TICKS_PER_SECOND - 1, ClockTicksUntilNextEvent(clock, CLOCK_EVENT_MINUTE));
+
+    // Con la alarma deshabilitada solo cuenta el minuto
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &alarm_time));
+    TEST_ASSERT_EQUAL_UINT32(60 * CLOCK_TICKS_PER_SECOND - 1,
+                             ClockTicksUntilNextEvent(clock, CLOCK_EVENT_MINUTE | CLOCK_EVENT_ALARM));
+
+    ClockEnableAlarm(clock);
+    TEST_ASSERT_EQUAL_UINT32(30 * CLOCK_TICKS_PER_SECOND - 1,
+                             ClockTicksUntilNextEvent(clock, CLOCK_EVENT_MINUTE | CLOCK_EVENT_ALARM));
+}
+
+// Durmiendo hasta el proximo evento durante varios dias no se pierde ninguna alarma ni suena tarde.
+void test_sleeping_until_next_event_never_misses_alarm(void) {
+    static const clock_time_t start_time = {.time = {.seconds = {0, 3}, .minutes = {8, 5}, .hours = {3, 2}}};
+    static const clock_time_t alarm_time = {.time = {.seconds = {7, 1}, .minutes = {1, 0}, .hours = {0, 0}}};
+    uint32_t alarms = 0;
+    uint32_t wakeups = 0;
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &start_time));
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &alarm_time));
+    ClockEnableAlarm(clock);
+
+    for (uint64_t elapsed = 0; elapsed < 3 * 86400 * CLOCK_TICKS_PER_SECOND;) {
+        uint32_t ticks = ClockTicksUntilNextEvent(clock, CLOCK_EVENT_MINUTE | CLOCK_EVENT_ALARM);
+        TEST_ASSERT_GREATER_THAN_UINT32(0, ticks);
+
+        if (ClockAdvanceTicks(clock, ticks)) {
+            // Tiene que despertarse justo en la hora de vencimiento, ni antes ni despues
+            alarms++;
+            if (alarms == 1) {
+                TEST_ASSERT_TIME(0, 0, 0, 1, 1, 7, current_time);
+                TEST_ASSERT_TRUE(ClockSnoozeAlarm(clock, 5));
+            } else if (alarms == 2) {
+                TEST_ASSERT_TIME(0, 0, 0, 6, 0, 0, current_time);
+                TEST_ASSERT_TRUE(ClockCancelAlarmUntilNextDay(clock));
+            } else {
+                TEST_ASSERT_TIME(0, 0, 0, 1, 1, 7, current_time);
+                TEST_ASSERT_TRUE(ClockCancelAlarmUntilNextDay(clock));
+            }
+        }
+        elapsed += ticks;
+        wakeups++;
+    }
+
+    // Suena el primer dia, vuelve a sonar a las 00:06:00 por la alarma pospuesta y luego una vez por dia
+    TEST_ASSERT_EQUAL_UINT32(4, alarms);
+    TEST_ASSERT_LESS_THAN_UINT32(3 * 1440 + 10, wakeups);
+}
+
+// Las alarmas agregadas se recorren ordenadas por hora y la alarma principal siempre esta en la tabla
+void test_alarm_table_is_sorted_by_time(void) {
+    static const clock_time_t evening = {.time = {.seconds = {0, 0}, .minutes = {0, 3}, .hours = {1, 2}}};
+    static const clock_time_t morning = {.time = {.seconds = {0, 0}, .minutes = {5, 4}, .hours = {6, 0}}};
+    clock_alarm_info_t info;
+
+    uint8_t first = ClockAddAlarm(clock, &evening);
+    uint8_t second = ClockAddAlarm(clock, &morning);
+    TEST_ASSERT_NOT_EQUAL(CLOCK_INVALID_ALARM, first);
+    TEST_ASSERT_NOT_EQUAL(CLOCK_INVALID_ALARM, second);
+    TEST_ASSERT_NOT_EQUAL(first, second);
+    TEST_ASSERT_EQUAL_UINT8(3, ClockGetAlarmCount(clock));
+
+    TEST_ASSERT_TRUE(ClockGetAlarm(clock, 0, &info));
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_MAIN_ALARM, info.id);
+    TEST_ASSERT_FALSE(info.enabled);
+    TEST_ASSERT_TRUE(ClockGetAlarm(clock, 1, &info));
+    TEST_ASSERT_EQUAL_UINT8(second, info.id);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(morning.bcd, info.time.bcd, 6);
+    TEST_ASSERT_TRUE(info.enabled);
+    TEST_ASSERT_TRUE(ClockGetAlarm(clock, 2, &info));
+    TEST_ASSERT_EQUAL_UINT8(first, info.id);
+    TEST_ASSERT_FALSE(ClockGetAlarm(clock, 3, &info));
+
+    TEST_ASSERT_FALSE(ClockRemoveAlarm(clock, CLOCK_MAIN_ALARM));
+    TEST_ASSERT_TRUE(ClockRemoveAlarm(clock, second));
+    TEST_ASSERT_FALSE(ClockRemoveAlarm(clock, second));
+    TEST_ASSERT_EQUAL_UINT8(2, ClockGetAlarmCount(clock));
+}
+
+// Cada alarma habilitada de la tabla suena a su hora y las deshabilitadas no
+void test_multiple_alarms_trigger_in_order(void) {
+    static const clock_time_t current = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {7, 0}}};
+    static const clock_time_t first = {.time = {.seconds = {0, 0}, .minutes = {0, 1}, .hours = {7, 0}}};
+    static const clock_time_t second = {.time = {.seconds = {0, 0}, .minutes = {0, 2}, .hours = {7, 0}}};
+    static const clock_time_t third = {.time = {.seconds = {0, 0}, .minutes = {0, 3}, .hours = {7, 0}}};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &current));
+    ClockAddAlarm(clock, &third);
+    ClockAddAlarm(clock, &first);
+    TEST_ASSERT_TRUE(ClockDisableAlarmById(clock, ClockAddAlarm(clock, &second)));
+
+    TEST_ASSERT_EQUAL_UINT32(599 * CLOCK_TICKS_PER_SECOND + CLOCK_TICKS_PER_SECOND,
+                             ClockTicksUntilNextEvent(clock, CLOCK_EVENT_ALARM));
+    SimulateSeconds(clock, 600);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_TRUE(ClockCancelAlarmUntilNextDay(clock));
+
+    SimulateSeconds(clock, 600);
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+
+    SimulateSeconds(clock, 600);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+}
+
+// Las alarmas pospuestas ocupan un lugar en la tabla hasta que suenan
+void test_snoozed_alarm_is_removed_after_triggering(void) {
+    static const clock_time_t current = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {7, 0}}};
+    clock_alarm_info_t info;
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &current));
+    uint8_t id = ClockAddAlarm(clock, &current);
+    SimulateSeconds(clock, 24 * 60 * 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+
+    TEST_ASSERT_TRUE(ClockSnoozeAlarm(clock, 5));
+    TEST_ASSERT_EQUAL_UINT8(3, ClockGetAlarmCount(clock));
+    TEST_ASSERT_TRUE(ClockGetAlarm(clock, 2, &info));
+    TEST_ASSERT_TRUE(info.snooze);
+
+    SimulateSeconds(clock, 5 * 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_EQUAL_UINT8(2, ClockGetAlarmCount(clock));
+
+    // Al deshabilitar la alarma tambien se descartan sus alarmas pospuestas
+    TEST_ASSERT_TRUE(ClockSnoozeAlarm(clock, 5));
+    TEST_ASSERT_TRUE(ClockDisableAlarmById(clock, id));
+    TEST_ASSERT_EQUAL_UINT8(2, ClockGetAlarmCount(clock));
+}
+
+// Cancelar hasta el dia siguiente descarta solo las alarmas pospuestas de la alarma que esta sonando
+void test_cancel_keeps_snoozes_of_other_alarms(void) {
+    static const clock_time_t current = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {7, 0}}};
+    static const clock_time_t first = {.time = {.seconds = {0, 0}, .minutes = {1, 0}, .hours = {7, 0}}};
+    static const clock_time_t second = {.time = {.seconds = {0, 0}, .minutes = {2, 0}, .hours = {7, 0}}};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &current));
+    ClockAddAlarm(clock, &first);
+    ClockAddAlarm(clock, &second);
+
+    SimulateSeconds(clock, 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_TRUE(ClockSnoozeAlarm(clock, 5)); // La primera alarma vuelve a sonar a las 07:06
+
+    SimulateSeconds(clock, 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_TRUE(ClockCancelAlarmUntilNextDay(clock));
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+
+    SimulateSeconds(clock, 4 * 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+}
+
+// La tabla de alarmas tiene capacidad limitada
+void test_alarm_table_full(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {7, 0}}};
+
+    for (int index = 1; index < CLOCK_MAX_ALARMS; index++) {
+        TEST_ASSERT_NOT_EQUAL(CLOCK_INVALID_ALARM, ClockAddAlarm(clock, &alarm_time));
+    }
+    TEST_ASSERT_EQUAL(CLOCK_INVALID_ALARM, ClockAddAlarm(clock, &alarm_time));
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &alarm_time));
+    TEST_ASSERT_FALSE(ClockSnoozeAlarm(clock, 5));
+}
+
+// El reloj empieza el 1 de enero de 2000 y la fecha avanza al pasar la medianoche
+void test_date_advances_at_midnight(void) {
+    static const clock_time_t last_second = {.time = {.seconds = {9, 5}, .minutes = {9, 5}, .hours = {3, 2}}};
+    clock_date_t date;
+
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT16(2000, date.year);
+    TEST_ASSERT_EQUAL_UINT8(1, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_SATURDAY, date.weekday);
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &last_second));
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT8(2, date.day);
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_SUNDAY, ClockGetWeekday(clock));
+}
+
+// Los años bisiestos y los cambios de mes y de año se calculan a partir de la tabla de meses
+void test_date_handles_leap_years_and_month_lengths(void) {
+    static const clock_date_t leap = {.year = 2024, .month = 2, .day = 28};
+    static const clock_date_t common = {.year = 2023, .month = 2, .day = 28};
+    static const clock_date_t new_year = {.year = 2025, .month = 12, .day = 31};
+    clock_date_t date;
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &(clock_time_t){0}));
+    TEST_ASSERT_TRUE(ClockSetDate(clock, &leap));
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_WEDNESDAY, ClockGetWeekday(clock));
+    TEST_ASSERT_TRUE(ClockAdvanceTicks(clock, 0) == false);
+    ClockAdvanceTicks(clock, 24 * 60 * 60 * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT8(2, date.month);
+    TEST_ASSERT_EQUAL_UINT8(29, date.day);
+    ClockAdvanceTicks(clock, 24 * 60 * 60 * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT8(3, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_FRIDAY, date.weekday);
+
+    TEST_ASSERT_TRUE(ClockSetDate(clock, &common));
+    ClockAdvanceTicks(clock, 24 * 60 * 60 * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT8(3, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+
+    TEST_ASSERT_TRUE(ClockSetDate(clock, &new_year));
+    ClockAdvanceTicks(clock, 24 * 60 * 60 * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockGetDate(clock, &date));
+    TEST_ASSERT_EQUAL_UINT16(2026, date.year);
+    TEST_ASSERT_EQUAL_UINT8(1, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_THURSDAY, date.weekday);
+}
+
+// No se aceptan fechas que no existen o fuera del rango del calendario
+void test_set_invalid_date_values(void) {
+    TEST_ASSERT_FALSE(ClockSetDate(clock, &(clock_date_t){.year = 2023, .month = 2, .day = 29}));
+    TEST_ASSERT_FALSE(ClockSetDate(clock, &(clock_date_t){.year = 2024, .month = 4, .day = 31}));
+    TEST_ASSERT_FALSE(ClockSetDate(clock, &(clock_date_t){.year = 2024, .month = 13, .day = 1}));
+    TEST_ASSERT_FALSE(ClockSetDate(clock, &(clock_date_t){.year = 2024, .month = 1, .day = 0}));
+    TEST_ASSERT_FALSE(ClockSetDate(clock, &(clock_date_t){.year = 1999, .month = 12, .day = 31}));
+    TEST_ASSERT_FALSE(ClockSetDate(clock, NULL));
+    TEST_ASSERT_TRUE(ClockSetDate(clock, &(clock_date_t){.year = 2099, .month = 12, .day = 31}));
+}
+
+// Una alarma de lunes a viernes no suena el fin de semana, ni aunque el reloj salte varios dias de una vez
+void test_alarm_only_triggers_on_selected_weekdays(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {7, 0}}};
+    static const clock_date_t friday = {.year = 2025, .month = 10, .day = 17};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &alarm_time));
+    TEST_ASSERT_TRUE(ClockSetDate(clock, &friday));
+    uint8_t id = ClockAddAlarm(clock, &alarm_time);
+    TEST_ASSERT_TRUE(ClockSetAlarmWeekdays(clock, id, CLOCK_WORKDAYS));
+    TEST_ASSERT_FALSE(ClockSetAlarmWeekdays(clock, id, 0x80));
+
+    SimulateSeconds(clock, 2 * 24 * 60 * 60);
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_SUNDAY, ClockGetWeekday(clock));
+
+    SimulateSeconds(clock, 24 * 60 * 60);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_TRUE(ClockCancelAlarmUntilNextDay(clock));
+
+    TEST_ASSERT_TRUE(ClockSetAlarmWeekdays(clock, id, CLOCK_DAY_MASK(CLOCK_SATURDAY)));
+    TEST_ASSERT_FALSE(ClockAdvanceTicks(clock, 4 * 24 * 60 * 60 * CLOCK_TICKS_PER_SECOND));
+    TEST_ASSERT_TRUE(ClockAdvanceTicks(clock, 24 * 60 * 60 * CLOCK_TICKS_PER_SECOND));
+    TEST_ASSERT_EQUAL_UINT8(CLOCK_SATURDAY, ClockGetWeekday(clock));
+}
+
+// Con una corrección de frecuencia cada segundo dura el valor ideal redondeado hacia arriba o hacia abajo
+void test_calibrated_seconds_stay_within_one_tick(void) {
+    clock_storage_t storage;
+    clock_t calibrated = ClockCreateStatic(&storage, 1000);
+    clock_time_t current_time;
+    uint32_t ticks = 0;
+    uint32_t long_seconds = 0;
+
+    TEST_ASSERT_TRUE(ClockSetTime(calibrated, &(clock_time_t){0}));
+    TEST_ASSERT_TRUE(ClockSetCalibration(calibrated, 250));
+    TEST_ASSERT_FALSE(ClockSetCalibration(calibrated, CLOCK_MAX_CALIBRATION_PPM + 1));
+
+    for (uint32_t second = 1; second <= 100; second++) {
+        uint32_t second_ticks = 0;
+        do {
+            ClockNewTick(calibrated);
+            second_ticks++;
+            ClockGetTime(calibrated, &current_time);
+        } while (current_time.time.seconds[0] != second % 10);
+
+        TEST_ASSERT_TRUE(second_ticks == 1000 || second_ticks == 1001);
+        long_seconds += (second_ticks == 1001);
+        ticks += second_ticks;
+    }
+    // 100 segundos de 1000,25 ticks son 100025 ticks, uno de cada cuatro segundos dura un tick mas
+    TEST_ASSERT_EQUAL_UINT32(25, long_seconds);
+    TEST_ASSERT_EQUAL_UINT32(100025, ticks);
+}
+
+// Una fuente de ticks 37 ppm rapida adelanta el reloj mas de un minuto y medio en 30 dias, con la corrección el error
+// residual es menor a un tick
+void test_calibration_removes_drift_over_thirty_days(void) {
+    // En un dia real la fuente entrega 86400 * 1000,037 ticks
+    static const uint32_t ticks_per_day = 86403196;
+    static const uint32_t ticks_remainder = 800; // Fraccion de tick por dia, en milesimas
+    clock_storage_t storage[2];
+    clock_t drifting = ClockCreateStatic(&storage[0], 1000);
+    clock_t calibrated = ClockCreateStatic(&storage[1], 1000);
+    clock_time_t current_time;
+    clock_date_t date;
+    uint32_t fraction = 0;
+
+    TEST_ASSERT_TRUE(ClockSetTime(drifting, &(clock_time_t){0}));
+    TEST_ASSERT_TRUE(ClockSetTime(calibrated, &(clock_time_t){0}));
+    TEST_ASSERT_TRUE(ClockSetCalibration(calibrated, 37));
+
+    for (int day = 0; day < 30; day++) {
+        uint32_t ticks = ticks_per_day;
+        fraction += ticks_remainder;
+        if (fraction >= 1000) {
+            fraction -= 1000;
+            ticks++;
+        }
+        ClockAdvanceTicks(drifting, ticks);
+        ClockAdvanceTicks(calibrated, ticks);
+    }
+
+    // Sin corregir el reloj se adelanta 30 * 86400 * 37 / 1000000 = 95,9 segundos
+    TEST_ASSERT_TRUE(ClockGetTime(drifting, &current_time));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(((uint8_t[]){5, 3, 1, 0, 0, 0}), current_time.bcd, 6);
+
+    // Con la corrección pasaron exactamente 30 dias y no queda ningun tick de error
+    TEST_ASSERT_TRUE(ClockGetTime(calibrated, &current_time));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(((uint8_t[]){0, 0, 0, 0, 0, 0}), current_time.bcd, 6);
+    TEST_ASSERT_TRUE(ClockGetDate(calibrated, &date));
+    TEST_ASSERT_EQUAL_UINT8(1, date.month);
+    TEST_ASSERT_EQUAL_UINT8(31, date.day);
+    TEST_ASSERT_EQUAL_UINT32(1001, ClockTicksUntilNextEvent(calibrated, CLOCK_EVENT_SECOND));
+}
+
+// La función de eventos recibe solo los eventos pedidos, cuando ocurren
+void test_event_handler_receives_requested_events(void) {
+    static const clock_time_t current = {.time = {.seconds = {0, 3}, .minutes = {9, 5}, .hours = {6, 0}}};
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {1, 0}, .hours = {7, 0}}};
+    event_log_t log = {0};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &current));
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &alarm_time));
+    ClockEnableAlarm(clock);
+    TEST_ASSERT_TRUE(ClockSetEventHandler(clock, LogEvents, &log, CLOCK_EVENT_MINUTE | CLOCK_EVENT_ALARM));
+
+    SimulateSeconds(clock, 29);
+    TEST_ASSERT_EQUAL_UINT32(0, log.calls);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_EQUAL_UINT32(1, log.minutes);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(((uint8_t[]){0, 0, 0, 0, 7, 0}), log.last_minute_time.bcd, 6);
+
+    SimulateSeconds(clock, 60);
+    TEST_ASSERT_EQUAL_UINT32(2, log.calls);
+    TEST_ASSERT_EQUAL_UINT32(2, log.minutes);
+    TEST_ASSERT_EQUAL_UINT32(1, log.alarms);
+    TEST_ASSERT_EQUAL_UINT32(0, log.seconds);
+}
+
+// Al avanzar varios segundos de una vez los eventos se informan en una sola llamada
+void test_event_handler_with_advance_ticks(void) {
+    event_log_t log = {0};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &(clock_time_t){0}));
+    TEST_ASSERT_TRUE(ClockSetEventHandler(clock, LogEvents, &log, CLOCK_EVENT_SECOND | CLOCK_EVENT_MINUTE));
+
+    ClockAdvanceTicks(clock, 59 * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_EQUAL_UINT32(1, log.calls);
+    TEST_ASSERT_EQUAL_UINT32(0, log.minutes);
+    ClockAdvanceTicks(clock, 3 * 60 * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_EQUAL_UINT32(2, log.calls);
+    TEST_ASSERT_EQUAL_UINT32(1, log.minutes);
+    ClockAdvanceTicks(clock, CLOCK_TICKS_PER_SECOND - 1);
+    TEST_ASSERT_EQUAL_UINT32(2, log.calls);
+
+    TEST_ASSERT_TRUE(ClockSetEventHandler(clock, NULL, NULL, 0));
+    ClockAdvanceTicks(clock, 60 * CLOCK_TICKS_PER_SECOND);
+    TEST_ASSERT_EQUAL_UINT32(2, log.calls);
+}
+
 /* === End of conditional blocks =================================================================================== */
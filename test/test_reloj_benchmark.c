@@ -0,0 +1,163 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_reloj_benchmark.c
+ ** @brief Mide en el host cuantos ticks por segundo procesa el reloj, comparado con el motor BCD anterior.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _POSIX_C_SOURCE 199309L // Necesario para gettimeofday con -std=c99
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h> // No se usa time.h porque su clock_t choca con el del reloj
+#include "unity.h"
+#include "clock.h"
+
+/* === Private macros definitions ================================================================================ */
+#define BENCHMARK_TICKS_PER_SECOND 1000     // Misma frecuencia que usa la aplicacion
+#define BENCHMARK_TICKS            50000000 // Ticks simulados en cada medicion
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Copia del estado del reloj anterior, que llevaba la hora en BCD y la comparaba en cada tick.
+ */
+typedef struct {
+    uint16_t clock_ticks;
+    uint16_t ticks_per_second;
+    clock_time_t current_time;
+    clock_time_t alarm_time;
+    bool alarm_enabled;
+    bool alarm_triggered;
+} legacy_clock_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Implementacion anterior de ClockNewTick, con la cascada de acarreos BCD y la comparacion de 6 bytes.
+ */
+static void LegacyNewTick(legacy_clock_t * self);
+
+/**
+ * @brief Devuelve el tiempo actual del host en microsegundos.
+ */
+static uint64_t NowMicroseconds(void);
+
+/**
+ * @brief Calcula los ticks procesados por segundo a partir del tiempo medido.
+ */
+static uint64_t TicksPerSecond(uint32_t ticks, uint64_t elapsed_us);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void LegacyNewTick(legacy_clock_t * self) {
+    self->clock_ticks++;
+    if (self->clock_ticks == self->ticks_per_second) {
+        self->clock_ticks = 0;
+        self->current_time.time.seconds[0]++;
+        if (self->current_time.time.seconds[0] > 9) {
+            self->current_time.time.seconds[0] = 0;
+            self->current_time.time.seconds[1]++;
+            if (self->current_time.time.seconds[1] > 5) {
+                self->current_time.time.seconds[1] = 0;
+                self->current_time.time.minutes[0]++;
+                if (self->current_time.time.minutes[0] > 9) {
+                    self->current_time.time.minutes[0] = 0;
+                    self->current_time.time.minutes[1]++;
+                    if (self->current_time.time.minutes[1] > 5) {
+                        self->current_time.time.minutes[1] = 0;
+                        self->current_time.time.hours[0]++;
+                        if (self->current_time.time.hours[0] > 9) {
+                            self->current_time.time.hours[0] = 0;
+                            self->current_time.time.hours[1]++;
+                        }
+                        if (self->current_time.time.hours[1] > 2 ||
+                            (self->current_time.time.hours[1] == 2 && self->current_time.time.hours[0] > 3)) {
+                            memset(&self->current_time, 0, sizeof(clock_time_t));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (self->alarm_enabled && ClockTimesMatch(&self->current_time, &self->alarm_time)) {
+        self->alarm_triggered = true;
+    }
+}
+
+static uint64_t NowMicroseconds(void) {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return (uint64_t)now.tv_sec * 1000000 + now.tv_usec;
+}
+
+static uint64_t TicksPerSecond(uint32_t ticks, uint64_t elapsed_us) {
+    if (elapsed_us == 0) {
+        elapsed_us = 1;
+    }
+    return (uint64_t)ticks * 1000000 / elapsed_us;
+}
+
+/* === Public function implementation ========================================================= */
+
+// Ambos motores llegan a la misma hora y se informa cuantos ticks por segundo procesa cada uno.
+void test_benchmark_ticks_per_second(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {2, 1}}};
+    char message[128];
+
+    legacy_clock_t legacy = {.ticks_per_second = BENCHMARK_TICKS_PER_SECOND, .alarm_enabled = true};
+    memcpy(&legacy.alarm_time, &alarm_time, sizeof(clock_time_t));
+
+    clock_t clock = ClockCreate(BENCHMARK_TICKS_PER_SECOND);
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &(clock_time_t){0}));
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &alarm_time));
+    ClockEnableAlarm(clock);
+
+    uint64_t start = NowMicroseconds();
+    for (uint32_t i = 0; i < BENCHMARK_TICKS; i++) {
+        LegacyNewTick(&legacy);
+    }
+    uint64_t legacy_us = NowMicroseconds() - start;
+
+    start = NowMicroseconds();
+    for (uint32_t i = 0; i < BENCHMARK_TICKS; i++) {
+        ClockNewTick(clock);
+    }
+    uint64_t binary_us = NowMicroseconds() - start;
+
+    clock_time_t current_time;
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &current_time));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(legacy.current_time.bcd, current_time.bcd, sizeof(clock_time_t));
+    TEST_ASSERT_EQUAL(legacy.alarm_triggered, ClockIsAlarmTriggered(clock));
+
+    snprintf(message, sizeof(message), "BCD anterior: %llu ticks/s",
+             (unsigned long long)TicksPerSecond(BENCHMARK_TICKS, legacy_us));
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message), "Segundos binarios: %llu ticks/s",
+             (unsigned long long)TicksPerSecond(BENCHMARK_TICKS, binary_us));
+    TEST_MESSAGE(message);
+}
+
+/* === End of conditional blocks =================================================================================== */
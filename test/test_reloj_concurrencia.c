@@ -0,0 +1,169 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_reloj_concurrencia.c
+ ** @brief Verifica en el host que las lecturas del reloj desde otras tareas nunca devuelven una hora mezclada.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "clock.h"
+#include "host_tasks.h"
+
+/* === Private macros definitions ================================================================================ */
+#define STRESS_ADVANCES 2000000 // Segundos que avanza la tarea que escribe el reloj
+#define STRESS_READERS  3       // Cantidad de tareas que leen el reloj al mismo tiempo
+#define SECONDS_PER_DAY 86400
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Resultado de las lecturas realizadas por una tarea lectora.
+ */
+typedef struct {
+    uint32_t reads;  // Cantidad de lecturas realizadas
+    uint32_t errors; // Cantidad de lecturas con una hora imposible
+} reader_result_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Convierte una hora BCD a segundos desde las 00:00:00, o devuelve UINT32_MAX si algun digito es invalido.
+ */
+static uint32_t SnapshotSeconds(const clock_time_t * time);
+
+/**
+ * @brief Tarea que avanza el reloj de a un segundo y publica cuantos segundos lleva avanzados.
+ */
+static void WriterTask(void * argument);
+
+/**
+ * @brief Tarea que cambia la hora de la alarma alternando entre dos valores mientras el reloj avanza.
+ */
+static void AlarmWriterTask(void * argument);
+
+/**
+ * @brief Tarea que lee la hora y la alarma y verifica que sean consistentes con lo publicado por las escrituras.
+ */
+static void ReaderTask(void * argument);
+
+/* === Private variable definitions ================================================================================ */
+
+static const clock_time_t START_TIME = {.time = {.seconds = {0, 5}, .minutes = {9, 5}, .hours = {2, 1}}};
+static const clock_time_t ALARM_A = {.time = {.seconds = {9, 5}, .minutes = {9, 5}, .hours = {3, 2}}};
+static const clock_time_t ALARM_B = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {0, 0}}};
+
+clock_t clock;
+static uint32_t published; // Segundos avanzados por WriterTask, se accede solo con operaciones atomicas
+static bool finished;      // Indica que WriterTask terminó, se accede solo con operaciones atomicas
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t SnapshotSeconds(const clock_time_t * time) {
+    if (time->time.seconds[0] > 9 || time->time.seconds[1] > 5 || time->time.minutes[0] > 9 ||
+        time->time.minutes[1] > 5 || time->time.hours[0] > 9 || time->time.hours[1] > 2) {
+        return UINT32_MAX;
+    }
+
+    uint32_t hours = time->time.hours[1] * 10 + time->time.hours[0];
+    uint32_t minutes = time->time.minutes[1] * 10 + time->time.minutes[0];
+    uint32_t seconds = time->time.seconds[1] * 10 + time->time.seconds[0];
+    return (hours > 23) ? UINT32_MAX : (hours * 3600 + minutes * 60 + seconds);
+}
+
+static void WriterTask(void * argument) {
+    (void)argument;
+
+    for (uint32_t advance = 1; advance <= STRESS_ADVANCES; advance++) {
+        ClockAdvanceTicks(clock, 1);
+        __atomic_store_n(&published, advance, __ATOMIC_RELEASE);
+    }
+    __atomic_store_n(&finished, true, __ATOMIC_RELEASE);
+}
+
+static void AlarmWriterTask(void * argument) {
+    (void)argument;
+
+    for (uint32_t count = 0; !__atomic_load_n(&finished, __ATOMIC_ACQUIRE); count++) {
+        ClockSetAlarmTime(clock, (count & 1) ? &ALARM_A : &ALARM_B);
+    }
+}
+
+static void ReaderTask(void * argument) {
+    reader_result_t * result = argument;
+    uint32_t start = SnapshotSeconds(&START_TIME);
+    clock_time_t current_time;
+    clock_time_t alarm_time;
+
+    while (!__atomic_load_n(&finished, __ATOMIC_ACQUIRE)) {
+        uint32_t before = __atomic_load_n(&published, __ATOMIC_ACQUIRE);
+        ClockGetTime(clock, &current_time);
+        uint32_t after = __atomic_load_n(&published, __ATOMIC_ACQUIRE);
+        ClockGetAlarmTime(clock, &alarm_time);
+
+        // La hora leida tiene que estar entre la publicada antes y la siguiente a la publicada despues de la lectura
+        uint32_t seconds = SnapshotSeconds(&current_time);
+        uint32_t offset = (seconds + 2 * SECONDS_PER_DAY - start - before % SECONDS_PER_DAY) % SECONDS_PER_DAY;
+        if (seconds == UINT32_MAX || offset > after - before + 1) {
+            result->errors++;
+        }
+        if (!ClockTimesMatch(&alarm_time, &ALARM_A) && !ClockTimesMatch(&alarm_time, &ALARM_B)) {
+            result->errors++;
+        }
+        result->reads++;
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+void setUp(void) {
+    clock = ClockCreate(1);
+    __atomic_store_n(&published, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&finished, false, __ATOMIC_RELEASE);
+}
+
+// Varias tareas leen el reloj mientras otra lo adelanta lo mas rapido posible, cruzando todos los acarreos BCD, y
+// otra cambia la alarma. Ninguna lectura puede devolver una hora que el reloj no haya tenido durante la lectura.
+void test_readers_never_see_torn_time(void) {
+    reader_result_t results[STRESS_READERS] = {0};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &START_TIME));
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &ALARM_B));
+
+    for (int index = 0; index < STRESS_READERS; index++) {
+        TEST_ASSERT_TRUE(HostTaskStart(ReaderTask, &results[index]));
+    }
+    TEST_ASSERT_TRUE(HostTaskStart(AlarmWriterTask, NULL));
+    TEST_ASSERT_TRUE(HostTaskStart(WriterTask, NULL));
+    HostTasksJoin();
+
+    for (int index = 0; index < STRESS_READERS; index++) {
+        TEST_ASSERT_NOT_EQUAL(0, results[index].reads);
+        TEST_ASSERT_EQUAL_UINT32(0, results[index].errors);
+    }
+
+    clock_time_t current_time;
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &current_time));
+    TEST_ASSERT_EQUAL_UINT32((SnapshotSeconds(&START_TIME) + STRESS_ADVANCES) % SECONDS_PER_DAY,
+                             SnapshotSeconds(&current_time));
+}
+
+/* === End of conditional blocks =================================================================================== */
@@ -0,0 +1,149 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+/** @file test_reloj_un_nucleo.c
+ ** @brief Verifica que una tarea de mayor prioridad en el mismo núcleo puede leer el reloj mientras otra lo modifica.
+ ** @details Las escrituras del reloj se compilan con CLOCK_CRITICAL_HOOKS, como en la placa. La tarea que lee
+ ** desaloja a la que escribe desde un temporizador del host, por lo que la que escribe no avanza hasta que la lectura
+ ** termina: si la lectura esperara a una escritura interrumpida la prueba se abortaría.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "clock.h"
+#include "host_tasks.h"
+
+/* === Private macros definitions ================================================================================ */
+#define PREEMPT_ADVANCES 2000000 // Segundos que avanza la tarea que escribe el reloj
+#define PREEMPT_PERIOD   50      // Microsegundos entre activaciones de la tarea que lee el reloj
+#define SECONDS_PER_DAY  86400
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Convierte una hora BCD a segundos desde las 00:00:00, o devuelve UINT32_MAX si algun digito es invalido.
+ */
+static uint32_t SnapshotSeconds(const clock_time_t * time);
+
+/**
+ * @brief Tarea de mayor prioridad que lee la hora y la alarma y verifica que sean consistentes con lo publicado.
+ */
+static void ReaderTask(void * argument);
+
+/* === Private variable definitions ================================================================================ */
+
+static const clock_time_t START_TIME = {.time = {.seconds = {0, 5}, .minutes = {9, 5}, .hours = {2, 1}}};
+static const clock_time_t ALARM_A = {.time = {.seconds = {9, 5}, .minutes = {9, 5}, .hours = {3, 2}}};
+static const clock_time_t ALARM_B = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {0, 0}}};
+
+clock_t clock;
+static volatile uint32_t published; // Segundos avanzados por la tarea que escribe
+static volatile uint32_t reads;     // Cantidad de lecturas realizadas por ReaderTask
+static volatile uint32_t errors;    // Cantidad de lecturas con una hora imposible
+static volatile uint32_t writes;    // Escrituras del reloj iniciadas desde ReaderTask
+static volatile bool reading;       // Indica que ReaderTask se está ejecutando
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t SnapshotSeconds(const clock_time_t * time) {
+    if (time->time.seconds[0] > 9 || time->time.seconds[1] > 5 || time->time.minutes[0] > 9 ||
+        time->time.minutes[1] > 5 || time->time.hours[0] > 9 || time->time.hours[1] > 2) {
+        return UINT32_MAX;
+    }
+
+    uint32_t hours = time->time.hours[1] * 10 + time->time.hours[0];
+    uint32_t minutes = time->time.minutes[1] * 10 + time->time.minutes[0];
+    uint32_t seconds = time->time.seconds[1] * 10 + time->time.seconds[0];
+    return (hours > 23) ? UINT32_MAX : (hours * 3600 + minutes * 60 + seconds);
+}
+
+static void ReaderTask(void * argument) {
+    clock_time_t current_time;
+    clock_time_t alarm_time;
+    (void)argument;
+
+    reading = true;
+    ClockGetTime(clock, &current_time);
+    ClockGetAlarmTime(clock, &alarm_time);
+    reading = false;
+
+    // La escritura interrumpida pudo haber avanzado el reloj sin llegar a publicarlo
+    uint32_t seconds = SnapshotSeconds(&current_time);
+    uint32_t offset = (seconds + 2 * SECONDS_PER_DAY - SnapshotSeconds(&START_TIME) - published % SECONDS_PER_DAY) %
+                      SECONDS_PER_DAY;
+    if (seconds == UINT32_MAX || offset > 1) {
+        errors++;
+    }
+    if (!ClockTimesMatch(&alarm_time, &ALARM_A) && !ClockTimesMatch(&alarm_time, &ALARM_B)) {
+        errors++;
+    }
+    reads++;
+}
+
+/* === Public function implementation ========================================================= */
+
+void ClockCriticalEnter(void) {
+    if (reading) {
+        writes++;
+    }
+    HostSchedulerSuspend();
+}
+
+void ClockCriticalExit(void) {
+    HostSchedulerResume();
+}
+
+void setUp(void) {
+    clock = ClockCreate(1);
+    published = 0;
+    reads = 0;
+    errors = 0;
+    writes = 0;
+}
+
+void tearDown(void) {
+    HostPreemptStop();
+}
+
+// La tarea que lee se despierta periódicamente en medio de las escrituras de la tarea que avanza el reloj y cambia la
+// alarma. Como comparten el núcleo, solo puede terminar si nunca encuentra una escritura a medio hacer y si la lectura
+// no modifica el reloj.
+void test_higher_priority_reader_never_waits_for_writer(void) {
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &START_TIME));
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &ALARM_B));
+    TEST_ASSERT_TRUE(HostPreemptStart(ReaderTask, NULL, PREEMPT_PERIOD));
+
+    for (uint32_t advance = 1; advance <= PREEMPT_ADVANCES; advance++) {
+        ClockAdvanceTicks(clock, 1);
+        published = advance;
+        if (advance % 16 == 0) {
+            ClockSetAlarmTime(clock, (advance & 16) ? &ALARM_A : &ALARM_B);
+        }
+    }
+    HostPreemptStop();
+
+    TEST_ASSERT_NOT_EQUAL(0, reads);
+    TEST_ASSERT_EQUAL_UINT32(0, errors);
+    TEST_ASSERT_EQUAL_UINT32(0, writes);
+}
+
+/* === End of conditional blocks =================================================================================== */
@@ -0,0 +1,116 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_salidas.c
+ ** @brief Pruebas de los grupos de salidas digitales que se escriben por puerto.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "digital.h"
+#include "chip.h"
+
+/* === Private macros definitions ================================================================================ */
+
+#define RGB_GPIO    0  // Puerto del rojo y el azul, como en el poncho
+#define RED_BIT     11 // Terminal del rojo
+#define BLUE_BIT    10 // Terminal del azul
+#define GREEN_GPIO  1  // Puerto del verde
+#define GREEN_BIT   8  // Terminal del verde
+#define BUZZER_GPIO 5  // Puerto del zumbador
+#define BUZZER_BIT  2  // Terminal del zumbador
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static digital_output_storage_t storages[5];
+static digital_output_t red, green, blue, buzzer;
+static digital_outputs_t red_bit, green_bit, blue_bit, buzzer_bit;
+static digital_output_group_storage_t group_storage;
+static digital_output_group_t group;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+void setUp(void) {
+    HostGpioReset();
+    red = DigitalOutputCreateStatic(&storages[0], RGB_GPIO, RED_BIT, true);
+    green = DigitalOutputCreateStatic(&storages[1], GREEN_GPIO, GREEN_BIT, true);
+    blue = DigitalOutputCreateStatic(&storages[2], RGB_GPIO, BLUE_BIT, true);
+    buzzer = DigitalOutputCreateStatic(&storages[3], BUZZER_GPIO, BUZZER_BIT, false);
+
+    group = DigitalOutputGroupCreateStatic(&group_storage);
+    red_bit = DigitalOutputGroupAdd(group, red);
+    green_bit = DigitalOutputGroupAdd(group, green);
+    blue_bit = DigitalOutputGroupAdd(group, blue);
+    buzzer_bit = DigitalOutputGroupAdd(group, buzzer);
+    host_gpio_port_writes = 0;
+}
+
+// Cada salida ocupa un bit distinto del estado del grupo
+void test_outputs_get_distinct_bits(void) {
+    TEST_ASSERT_EQUAL_UINT8(0x0F, red_bit | green_bit | blue_bit | buzzer_bit);
+}
+
+// Escribir todo el grupo usa a lo sumo un SET y un CLR por puerto, con el mismo nivel que las salidas individuales
+void test_write_uses_one_set_and_one_clear_per_port(void) {
+    uint32_t expected[HOST_GPIO_PORTS];
+
+    DigitalOutputActivate(red);
+    DigitalOutputDeactivate(blue);
+    DigitalOutputActivate(green);
+    DigitalOutputActivate(buzzer);
+    for (uint8_t port = 0; port < HOST_GPIO_PORTS; port++) {
+        expected[port] = host_gpio.PIN[port];
+    }
+    DigitalOutputGroupWrite(group, 0xFF, ~(red_bit | green_bit | blue_bit | buzzer_bit));
+    host_gpio_port_writes = 0;
+
+    DigitalOutputGroupWrite(group, 0xFF, red_bit | green_bit | buzzer_bit);
+    TEST_ASSERT_EQUAL_HEX32_ARRAY(expected, host_gpio.PIN, HOST_GPIO_PORTS);
+    TEST_ASSERT_EQUAL_HEX32(1UL << RED_BIT, host_gpio.SET[RGB_GPIO]);
+    TEST_ASSERT_EQUAL_HEX32(1UL << BLUE_BIT, host_gpio.CLR[RGB_GPIO]);
+    TEST_ASSERT_EQUAL_UINT32(4, host_gpio_port_writes);
+}
+
+// Solo se escriben las salidas indicadas, las demás mantienen su estado
+void test_write_only_selected_outputs(void) {
+    DigitalOutputGroupWrite(group, 0xFF, red_bit | blue_bit);
+    DigitalOutputGroupWrite(group, blue_bit, 0);
+
+    TEST_ASSERT_BIT_HIGH(RED_BIT, host_gpio.PIN[RGB_GPIO]);
+    TEST_ASSERT_BIT_LOW(BLUE_BIT, host_gpio.PIN[RGB_GPIO]);
+}
+
+// Un grupo no acepta salidas de más puertos de los que puede escribir
+void test_group_rejects_extra_port(void) {
+    digital_output_t output = DigitalOutputCreateStatic(&storages[4], 2, 0, false);
+
+    TEST_ASSERT_NOT_EQUAL(0, DigitalOutputGroupAdd(group, output)); // Cuarto puerto
+    output = DigitalOutputCreateStatic(&storages[4], 7, 0, false);
+    TEST_ASSERT_EQUAL(0, DigitalOutputGroupAdd(group, output));
+}
+
+/* === End of conditional blocks =================================================================================== */